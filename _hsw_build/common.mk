@@ -0,0 +1 @@
+../common.mk
\ No newline at end of file
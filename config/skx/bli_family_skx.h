@@ -43,6 +43,10 @@
 #define BLIS_THREAD_MAX_IR      1
 #define BLIS_THREAD_MAX_JR      4
 
+// AVX-512 doubles the flops per cycle over AVX2, so require twice the
+// default amount of work per thread.
+#define BLIS_THREAD_MIN_FLOPS   1000000
+
 // -- MEMORY ALLOCATION --------------------------------------------------------
 
 #define BLIS_SIMD_ALIGN_SIZE             64
@@ -55,6 +55,12 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_3x8,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_3x4,
 
+	  // gemm (opposite storage preference)
+	  BLIS_GEMM_ALT_UKR,   BLIS_FLOAT,    bli_sgemm_haswell_asm_16x6,
+	  BLIS_GEMM_ALT_UKR,   BLIS_DOUBLE,   bli_dgemm_haswell_asm_8x6,
+	  BLIS_GEMM_ALT_UKR,   BLIS_SCOMPLEX, bli_cgemm_haswell_asm_8x3,
+	  BLIS_GEMM_ALT_UKR,   BLIS_DCOMPLEX, bli_zgemm_haswell_asm_4x3,
+
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_haswell_asm_6x8,
@@ -92,8 +98,6 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT, bli_sgemmsup_rv_zen_asm_6x16n,
 #endif
 
-#if 0
-	  // NOTE: This set of kernels is likely broken and therefore disabled.
 	  BLIS_GEMMSUP_RRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
 	  BLIS_GEMMSUP_RCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
 	  BLIS_GEMMSUP_RCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
@@ -107,7 +111,6 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMMSUP_RCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
 	  BLIS_GEMMSUP_CCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
-#endif
 
 	  // packm
 	  BLIS_PACKM_KER, BLIS_FLOAT,    bli_spackm_haswell_asm_6x16,
@@ -155,6 +158,9 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_SETV_KER,   BLIS_FLOAT,  bli_ssetv_zen_int,
 	  BLIS_SETV_KER,   BLIS_DOUBLE, bli_dsetv_zen_int,
 
+	  // i8gemm
+	  BLIS_I8GEMM_UKR, BLIS_I8GEMM_DT, bli_i8gemm_haswell_int_6x8,
+
 	  BLIS_VA_END
 	);
 
@@ -196,6 +202,20 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT,  TRUE,
 	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT,  TRUE,
 
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+
 	  BLIS_VA_END
 	);
 
@@ -219,9 +239,9 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	// Initialize sup thresholds with architecture-appropriate values.
 	//                                          s     d     c     z
 #if 1
-	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  500,  249,   -1,   -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  500,  249,   -1,   -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  500,  249,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  500,  249,  128,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  500,  249,  128,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  500,  249,  128,  128 );
 #else
 	bli_blksz_init_easy( &blkszs[ BLIS_MT ], 100000, 100000,   -1,   -1 );
 	bli_blksz_init_easy( &blkszs[ BLIS_NT ], 100000, 100000,   -1,   -1 );
@@ -231,12 +251,30 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	// Initialize level-3 sup blocksize objects with architecture-specific
 	// values.
 	//                                               s      d      c      z
-	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,    -1,    -1,
-	                                                 9,     9,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   168,    72,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  4080,  4080,    -1,    -1 );
+	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,     3,     3,
+	                                                 9,     9,     3,     3 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,     8,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   168,    72,    72,    36 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,   128,    64 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  4080,  4080,  2040,  1020 );
+
+	// Initialize int8 gemm blocksize objects. These are stored in the
+	// BLIS_I8GEMM_DT slots, but all slots are set for consistency.
+	//                                             s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_I8 ],     6,     6,     6,     6 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_I8 ],     8,     8,     8,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_I8 ],   144,   144,   144,   144 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_I8 ],  1024,  1024,  1024,  1024 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_I8 ],  4080,  4080,  4080,  4080 );
+
+	// Initialize blocksize objects for the gemm micro-kernels with the
+	// opposite storage preference (BLIS_GEMM_ALT_UKR).
+	//                                              s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_ALT ],    16,     8,     8,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_ALT ],     6,     6,     3,     3 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_ALT ],   112,    72,    56,    44 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_ALT ],   256,   256,   256,   256 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_ALT ],  4080,  4080,  4080,  4080 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
@@ -267,6 +305,20 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_NR_SUP, &blkszs[ BLIS_NR_SUP ], BLIS_NR_SUP,
 	  BLIS_MR_SUP, &blkszs[ BLIS_MR_SUP ], BLIS_MR_SUP,
 
+	  // int8 gemm
+	  BLIS_NC_I8, &blkszs[ BLIS_NC_I8 ], BLIS_NR_I8,
+	  BLIS_KC_I8, &blkszs[ BLIS_KC_I8 ], BLIS_KC_I8,
+	  BLIS_MC_I8, &blkszs[ BLIS_MC_I8 ], BLIS_MR_I8,
+	  BLIS_NR_I8, &blkszs[ BLIS_NR_I8 ], BLIS_NR_I8,
+	  BLIS_MR_I8, &blkszs[ BLIS_MR_I8 ], BLIS_MR_I8,
+
+	  // gemm (opposite storage preference)
+	  BLIS_NC_ALT, &blkszs[ BLIS_NC_ALT ], BLIS_NR_ALT,
+	  BLIS_KC_ALT, &blkszs[ BLIS_KC_ALT ], BLIS_KR,
+	  BLIS_MC_ALT, &blkszs[ BLIS_MC_ALT ], BLIS_MR_ALT,
+	  BLIS_NR_ALT, &blkszs[ BLIS_NR_ALT ], BLIS_NR_ALT,
+	  BLIS_MR_ALT, &blkszs[ BLIS_MR_ALT ], BLIS_MR_ALT,
+
 	  BLIS_VA_END
 	);
 
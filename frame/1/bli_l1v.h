@@ -60,6 +60,9 @@
 // Generate function pointer arrays for tapi functions (expert only).
 #include "bli_l1v_fpa.h"
 
+// Prototype the multithreaded implementations of level-1v operations.
+#include "bli_l1v_thread.h"
+
 // Pack-related
 // NOTE: packv and unpackv are temporarily disabled.
 //#include "bli_packv.h"
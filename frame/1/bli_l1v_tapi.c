@@ -62,6 +62,20 @@ void PASTEMAC(ch,opname,EX_SUF) \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	/* If the vectors are long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt && incy != 0 ) \
+	{ \
+		PASTEMAC(ch,copyv_thread) \
+		( \
+		  ti, nt, f, conjx, n, x, incx, y, incy, cntx \
+		); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -176,6 +190,20 @@ void PASTEMAC(ch,opname,EX_SUF) \
 		cntx = bli_gks_query_cntx(); \
 \
 	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	/* If the vectors are long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt && incy != 0 ) \
+	{ \
+		PASTEMAC(ch,axpyv_thread) \
+		( \
+		  ti, nt, f, conjx, n, alpha, x, incx, y, incy, cntx \
+		); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -216,6 +244,20 @@ void PASTEMAC(ch,opname,EX_SUF) \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	/* If the vectors are long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,dotv_thread) \
+		( \
+		  ti, nt, f, conjx, conjy, n, x, incx, y, incy, rho, cntx \
+		); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -330,6 +372,20 @@ void PASTEMAC(ch,opname,EX_SUF) \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	/* If the vectors are long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt && incx != 0 ) \
+	{ \
+		PASTEMAC(ch,scalv_thread) \
+		( \
+		  ti, nt, f, conjalpha, n, alpha, x, incx, cntx \
+		); \
+		return; \
+	} \
 \
 	f \
 	( \
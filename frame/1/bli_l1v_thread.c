@@ -0,0 +1,282 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Define the parameter structure passed to each thread. The fields that are
+// used depend on the operation.
+typedef struct
+{
+	      void_fp f;
+	      conj_t  conjx;
+	      conj_t  conjy;
+	      dim_t   n;
+	const void*   alpha;
+	const void*   x; inc_t incx;
+	      void*   y; inc_t incy;
+	      void*   rho;
+	const cntx_t* cntx;
+} l1v_thread_params_t;
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const l1v_thread_params_t* params = params_void; \
+\
+	const dim_t   nt = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	const ctype*  x  = params->x; \
+	      ctype*  y  = params->y; \
+	copyv_ker_ft  f  = params->f; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	f \
+	( \
+	  params->conjx, \
+	  end - start, \
+	  x + start*params->incx, params->incx, \
+	  y + start*params->incy, params->incy, \
+	  params->cntx  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             copyv_ker_ft f, \
+             conj_t       conjx, \
+             dim_t        n, \
+       const ctype*       x, inc_t incx, \
+             ctype*       y, inc_t incy, \
+       const cntx_t*      cntx  \
+     ) \
+{ \
+	l1v_thread_params_t params = \
+	{ \
+	  f, conjx, BLIS_NO_CONJUGATE, n, \
+	  NULL, x, incx, y, incy, NULL, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( copyv_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const l1v_thread_params_t* params = params_void; \
+\
+	const dim_t   nt = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	const ctype*  x  = params->x; \
+	      ctype*  y  = params->y; \
+	axpyv_ker_ft  f  = params->f; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	f \
+	( \
+	  params->conjx, \
+	  end - start, \
+	  params->alpha, \
+	  x + start*params->incx, params->incx, \
+	  y + start*params->incy, params->incy, \
+	  params->cntx  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             axpyv_ker_ft f, \
+             conj_t       conjx, \
+             dim_t        n, \
+       const ctype*       alpha, \
+       const ctype*       x, inc_t incx, \
+             ctype*       y, inc_t incy, \
+       const cntx_t*      cntx  \
+     ) \
+{ \
+	l1v_thread_params_t params = \
+	{ \
+	  f, conjx, BLIS_NO_CONJUGATE, n, \
+	  alpha, x, incx, y, incy, NULL, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( axpyv_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const l1v_thread_params_t* params = params_void; \
+\
+	const dim_t   nt = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	      ctype*  x  = params->y; \
+	scalv_ker_ft  f  = params->f; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	f \
+	( \
+	  params->conjx, \
+	  end - start, \
+	  params->alpha, \
+	  x + start*params->incy, params->incy, \
+	  params->cntx  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             scalv_ker_ft f, \
+             conj_t       conjalpha, \
+             dim_t        n, \
+       const ctype*       alpha, \
+             ctype*       x, inc_t incx, \
+       const cntx_t*      cntx  \
+     ) \
+{ \
+	/* Since x is the output vector, it is passed in the fields for y. */ \
+	l1v_thread_params_t params = \
+	{ \
+	  f, conjalpha, BLIS_NO_CONJUGATE, n, \
+	  alpha, NULL, 0, x, incx, NULL, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( scalv_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const l1v_thread_params_t* params = params_void; \
+\
+	const dim_t   nt  = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf  = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	const ctype*  x   = params->x; \
+	const ctype*  y   = params->y; \
+	      ctype*  rho = params->rho; \
+	dotv_ker_ft   f   = params->f; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	/* Compute this thread's partial dot product. */ \
+	f \
+	( \
+	  params->conjx, \
+	  params->conjy, \
+	  end - start, \
+	  x + start*params->incx, params->incx, \
+	  y + start*params->incy, params->incy, \
+	  rho + tid, \
+	  params->cntx  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             dotv_ker_ft  f, \
+             conj_t       conjx, \
+             conj_t       conjy, \
+             dim_t        n, \
+       const ctype*       x, inc_t incx, \
+       const ctype*       y, inc_t incy, \
+             ctype*       rho, \
+       const cntx_t*      cntx  \
+     ) \
+{ \
+	err_t r_val; \
+\
+	ctype* rho_thr = bli_malloc_intl( nt * sizeof( ctype ), &r_val ); \
+\
+	l1v_thread_params_t params = \
+	{ \
+	  f, conjx, conjy, n, \
+	  NULL, x, incx, ( ctype* )y, incy, rho_thr, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+\
+	/* Sum the partial dot products pairwise, in a fixed order, so that the
+	   result does not depend on the order in which the threads finish. */ \
+	for ( dim_t s = 1; s < nt; s *= 2 ) \
+		for ( dim_t i = 0; i + s < nt; i += 2*s ) \
+			bli_tadds( ch,ch,ch, rho_thr[ i + s ], rho_thr[ i ] ); \
+\
+	bli_tcopys( ch,ch, rho_thr[ 0 ], *rho ); \
+\
+	bli_free_intl( rho_thr ); \
+}
+
+INSERT_GENTFUNC_BASIC( dotv_thread )
+
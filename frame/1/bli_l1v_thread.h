@@ -0,0 +1,118 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototype BLAS-like interfaces with typed operands for the multithreaded
+// execution of level-1v operations. Each function partitions the vectors
+// among nt threads (using the threading implementation ti), each of which
+// invokes the kernel f on its subvectors. Each function may be used with
+// any operation whose kernel has the same signature as the operation after
+// which the function is named (e.g. bli_?copyv_thread() may also be used
+// to execute addv and subv).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             copyv_ker_ft f, \
+             conj_t       conjx, \
+             dim_t        n, \
+       const ctype*       x, inc_t incx, \
+             ctype*       y, inc_t incy, \
+       const cntx_t*      cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( copyv_thread )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             axpyv_ker_ft f, \
+             conj_t       conjx, \
+             dim_t        n, \
+       const ctype*       alpha, \
+       const ctype*       x, inc_t incx, \
+             ctype*       y, inc_t incy, \
+       const cntx_t*      cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( axpyv_thread )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             scalv_ker_ft f, \
+             conj_t       conjalpha, \
+             dim_t        n, \
+       const ctype*       alpha, \
+             ctype*       x, inc_t incx, \
+       const cntx_t*      cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( scalv_thread )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t      ti, \
+             dim_t        nt, \
+             dotv_ker_ft  f, \
+             conj_t       conjx, \
+             conj_t       conjy, \
+             dim_t        n, \
+       const ctype*       x, inc_t incx, \
+       const ctype*       y, inc_t incy, \
+             ctype*       rho, \
+       const cntx_t*      cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( dotv_thread )
+
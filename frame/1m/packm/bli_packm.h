@@ -43,4 +43,5 @@
 #include "bli_packm_struc_cxk.h"
 
 #include "bli_packm_blk_var1.h"
+#include "bli_packm_prepacked_var1.h"
 
@@ -36,6 +36,46 @@
 
 #include "blis.h"
 
+// Apply a prologue to a micropanel that was just packed, and then scale it by
+// kappa (if kappa is non-NULL). The prologue is invoked once per broadcast
+// copy of each element.
+static void bli_packm_blk_var1_prologue
+     (
+             packm_prologue_ft prologue,
+             void*             params,
+             bool              trans,
+             num_t             dt_p,
+             dim_t             panel_dim,
+             dim_t             panel_len,
+             dim_t             panel_dim_off,
+             dim_t             panel_len_off,
+             dim_t             bcast,
+       const void*             kappa,
+             char*             p, inc_t ldp,
+       const cntx_t*           cntx
+     )
+{
+	const dim_t dt_p_size = bli_dt_size( dt_p );
+
+	for ( dim_t d = 0; d < bcast; ++d )
+	{
+		char* p_d = p + d*dt_p_size;
+
+		if ( trans )
+			prologue( dt_p, panel_len, panel_dim, panel_len_off, panel_dim_off,
+			          p_d, ldp, bcast, params );
+		else
+			prologue( dt_p, panel_dim, panel_len, panel_dim_off, panel_len_off,
+			          p_d, bcast, ldp, params );
+	}
+
+	if ( kappa )
+	{
+		scalv_ker_ft f_scalv = bli_cntx_get_ukr_dt( dt_p, BLIS_SCALV_KER, cntx );
+
+		f_scalv( BLIS_NO_CONJUGATE, ldp * panel_len, kappa, p, 1, cntx );
+	}
+}
 
 void bli_packm_blk_var1
      (
@@ -108,6 +148,22 @@ void bli_packm_blk_var1
 	packm_ker_ft packm_ker_cast = bli_packm_def_cntl_ukr( cntl );
 	const void*  params         = bli_packm_def_cntl_ukr_params( cntl );
 
+	// Query the prologue (if any) to be applied to each packed micropanel.
+	// The prologue must see the elements before they are scaled, so any
+	// non-unit kappa is instead applied after the prologue.
+	packm_prologue_ft prologue        = bli_packm_def_cntl_prologue( cntl );
+	void*             prologue_params = bli_packm_def_cntl_prologue_params( cntl );
+	bool              prologue_trans  = bli_packm_def_cntl_prologue_trans( cntl );
+	char*             kappa_pro       = NULL;
+
+	if ( prologue )
+	{
+		char* one_cast = bli_obj_buffer_for_1x1( dt_p, &BLIS_ONE );
+
+		if ( kappa_cast != one_cast ) kappa_pro = kappa_cast;
+		kappa_cast = one_cast;
+	}
+
 	// Compute the total number of iterations we'll need.
 	dim_t n_iter = iter_dim / panel_dim_max + ( iter_dim % panel_dim_max ? 1 : 0 );
 
@@ -189,6 +245,24 @@ void bli_packm_blk_var1
 				  params,
 				  cntx
 				);
+
+				// Apply the prologue while the micropanel is still in cache.
+				if ( prologue )
+					bli_packm_blk_var1_prologue
+					(
+					  prologue,
+					  prologue_params,
+					  prologue_trans,
+					  dt_p,
+					  panel_dim_i,
+					  panel_len_full,
+					  panel_dim_off_i,
+					  panel_len_off,
+					  bcast_p,
+					  kappa_pro,
+					  p_begin, ldp,
+					  cntx
+					);
 			}
 
 			p_begin += ps_p*dt_p_size;
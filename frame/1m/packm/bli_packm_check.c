@@ -43,9 +43,10 @@ void bli_packm_init_check
 {
 	err_t e_val;
 
-	// Check object datatypes.
+	// Check object datatypes. Half-precision sources are widened during
+	// packing.
 
-	e_val = bli_check_floating_object( a );
+	e_val = bli_check_floating_or_half_object( a );
 	bli_check_error_code( e_val );
 
 	// Check control tree pointer.
@@ -66,7 +67,7 @@ void bli_packm_int_check
 
 	// Check object datatypes.
 
-	e_val = bli_check_floating_object( a );
+	e_val = bli_check_floating_or_half_object( a );
 	bli_check_error_code( e_val );
 
 	e_val = bli_check_floating_object( p );
@@ -94,6 +94,9 @@ void bli_packm_def_cntl_init_node
 	cntl->pack_schema        = pack_schema;
 	cntl->pack_buf_type      = pack_buf_type;
 	cntl->params             = cntl;
+	cntl->prologue           = NULL;
+	cntl->prologue_params    = NULL;
+	cntl->prologue_trans     = FALSE;
 
 	bli_packm_cntl_init_node
 	(
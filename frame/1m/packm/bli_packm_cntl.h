@@ -88,6 +88,13 @@ struct packm_def_cntl_s
 	pack_t       pack_schema;
 	packbuf_t    pack_buf_type;
 	const void*  params;
+
+	// An optional function applied to each micropanel once it is packed,
+	// its parameters, and whether the packed matrix is the transpose of the
+	// operand for which the function was specified.
+	packm_prologue_ft prologue;
+	void*        prologue_params;
+	bool         prologue_trans;
 };
 typedef struct packm_def_cntl_s packm_def_cntl_t;
 
@@ -153,6 +160,21 @@ BLIS_INLINE const void* bli_packm_def_cntl_ukr_params( const cntl_t* cntl )
 	return ( ( const packm_def_cntl_t* ) cntl )->params;
 }
 
+BLIS_INLINE packm_prologue_ft bli_packm_def_cntl_prologue( const cntl_t* cntl )
+{
+	return ( ( const packm_def_cntl_t* ) cntl )->prologue;
+}
+
+BLIS_INLINE void* bli_packm_def_cntl_prologue_params( const cntl_t* cntl )
+{
+	return ( ( const packm_def_cntl_t* ) cntl )->prologue_params;
+}
+
+BLIS_INLINE bool bli_packm_def_cntl_prologue_trans( const cntl_t* cntl )
+{
+	return ( ( const packm_def_cntl_t* ) cntl )->prologue_trans;
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE void bli_packm_def_cntl_set_bmult_m( const blksz_t* bmult_m, cntl_t* cntl_ )
@@ -226,6 +248,13 @@ BLIS_INLINE void bli_packm_def_cntl_set_ukr_params( const void* params, cntl_t*
 	( ( packm_def_cntl_t* ) cntl )->params = params;
 }
 
+BLIS_INLINE void bli_packm_def_cntl_set_prologue( packm_prologue_ft prologue, void* params, bool trans, cntl_t* cntl )
+{
+	( ( packm_def_cntl_t* ) cntl )->prologue        = prologue;
+	( ( packm_def_cntl_t* ) cntl )->prologue_params = params;
+	( ( packm_def_cntl_t* ) cntl )->prologue_trans  = trans;
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_EXPORT_BLIS void bli_packm_cntl_init_node
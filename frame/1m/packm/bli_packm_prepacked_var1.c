@@ -0,0 +1,100 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_packm_prepacked_var1
+     (
+       const obj_t*     c,
+             obj_t*     p,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread
+     )
+{
+	( void )cntx;
+	( void )thread;
+
+	// This variant is used in place of bli_packm_blk_var1() when the matrix
+	// was already packed ahead of time (e.g. via bli_gemm_pack_b()). In that
+	// case, c refers to a submatrix of the pre-packed matrix whose pack
+	// schema has been cleared so that it could be partitioned like any other
+	// matrix, and thus its offsets identify where the submatrix begins within
+	// the pre-packed micropanels. Since each micropanel spans the entire
+	// panel length (k dimension) of the pre-packed matrix, all we have to do
+	// is compute the address of the first micropanel of the submatrix and
+	// initialize p to refer to it; no data is copied.
+
+	num_t  dt_p       = bli_obj_dt( c );
+	num_t  dt_scalar  = bli_obj_scalar_dt( c );
+	pack_t schema     = bli_packm_def_cntl_pack_schema( cntl );
+
+	dim_t  m_p        = bli_obj_length( c );
+	dim_t  n_p        = bli_obj_width( c );
+	dim_t  off_m      = bli_obj_row_off( c );
+	dim_t  off_n      = bli_obj_col_off( c );
+
+	dim_t  panel_dim  = bli_obj_panel_dim( c );
+	inc_t  ps_p       = bli_obj_panel_stride( c );
+	inc_t  cs_p       = bli_obj_col_stride( c );
+	siz_t  elem_size  = bli_obj_elem_size( c );
+
+	// The partitioning loops only ever split the panel dimension at whole
+	// multiples of the register blocksize, so the submatrix must start at
+	// the beginning of a micropanel.
+	if ( off_m % panel_dim != 0 )
+		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
+
+	char*  buf_p      = ( char* )bli_obj_buffer( c ) +
+	                    ( ( off_m / panel_dim ) * ps_p + off_n * cs_p ) * elem_size;
+
+	// Begin by copying the fields of C.
+	bli_obj_alias_to( c, p );
+
+	// Typecast the internal scalar value to the target datatype, as is done
+	// by bli_packm_init().
+	if ( dt_scalar != dt_p )
+	{
+		bli_obj_scalar_cast_to( bli_dt_domain( dt_scalar ) | bli_dt_prec( dt_p ), p );
+	}
+
+	// Restore the pack schema and reset the view so that P refers to the
+	// micropanels of the submatrix.
+	bli_obj_set_pack_schema( schema, p );
+	bli_obj_set_buffer( buf_p, p );
+	bli_obj_set_offs( 0, 0, p );
+	bli_obj_set_padded_dims( bli_align_dim_to_mult( m_p, panel_dim, true ), n_p, p );
+	bli_obj_set_panel_width( n_p, p );
+}
+
@@ -304,3 +304,69 @@ void PASTEMAC(chc,chp,varname) \
 INSERT_GENTFUNC2RO( packm_struc_cxk )
 INSERT_GENTFUNC2RO_MIX_P( packm_struc_cxk )
 
+
+
+//
+// Half-precision (bfloat16 and float16) variants. These widen each element
+// to the computation datatype while packing, so the rest of the gemm
+// framework (and the real-domain micro-kernels) never see half-precision
+// data. Only general (unstructured) matrices may be stored in half
+// precision, which is enforced by the level-3 operand checks.
+//
+
+#undef  GENTFUNC2
+#define GENTFUNC2( ctypec, ctypep, chc, chp, varname ) \
+\
+void PASTEMAC(chc,chp,varname) \
+     ( \
+             struc_t strucc, \
+             diag_t  diagc, \
+             uplo_t  uploc, \
+             conj_t  conjc, \
+             pack_t  schema, \
+             bool    invdiag, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             dim_t   panel_dim_off, \
+             dim_t   panel_len_off, \
+             dim_t   panel_bcast, \
+       const void*   kappa, \
+       const void*   c, inc_t incc, inc_t ldc, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     ) \
+{ \
+	if ( !bli_is_general( strucc ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	const ctypep           kappa_cast = *( const ctypep* )kappa; \
+	const ctypec* restrict c1         = c; \
+	      ctypep* restrict p1         = p; \
+\
+	for ( dim_t l = 0; l < panel_len; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < panel_dim; ++i ) \
+		{ \
+			ctypep cpi = kappa_cast * PASTEMAC(chc,chp,cast)( *( c1 + i*incc ) ); \
+\
+			for ( dim_t d = 0; d < panel_bcast; ++d ) \
+				*( p1 + i*panel_bcast + d ) = cpi; \
+		} \
+\
+		c1 += ldc; \
+		p1 += ldp; \
+	} \
+\
+	bli_tset0s_edge \
+	( \
+	  chp, \
+	  panel_dim*panel_bcast, panel_dim_max*panel_bcast, \
+	  panel_len, panel_len_max, \
+	  ( ctypep* )p, ldp  \
+	); \
+}
+
+INSERT_GENTFUNC2_HALF( packm_struc_cxk )
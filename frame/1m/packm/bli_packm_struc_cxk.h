@@ -59,4 +59,5 @@ BLIS_EXPORT_BLIS void PASTEMAC(chc,chp,varname) \
 
 INSERT_GENTPROT2_BASIC( packm_struc_cxk )
 INSERT_GENTPROT2_MIX_P( packm_struc_cxk )
+INSERT_GENTPROT2_HALF( packm_struc_cxk )
 
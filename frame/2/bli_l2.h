@@ -60,6 +60,9 @@
 // Generate function pointer arrays for tapi functions (expert only).
 #include "bli_l2_fpa.h"
 
+// Prototype the multithreaded implementations of level-2 operations.
+#include "bli_l2_thread.h"
+
 // Operation-specific headers
 #include "bli_gemv.h"
 #include "bli_ger.h"
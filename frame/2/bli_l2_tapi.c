@@ -87,6 +87,21 @@ void PASTEMAC(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( m_y * n_x, BLIS_L2_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,opname,_thread) \
+		( \
+		  ti, nt, transa, conjx, m, n, alpha, a, rs_a, cs_a, \
+		  x, incx, beta, y, incy, cntx \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH(ch,ftname,_unb_ft) f; \
@@ -148,6 +163,21 @@ void PASTEMAC(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the problem is large enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( m * n, BLIS_L2_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,opname,_thread) \
+		( \
+		  ti, nt, conjx, conjy, m, n, alpha, x, incx, y, incy, \
+		  a, rs_a, cs_a, cntx \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH(ch,ftname,_unb_ft) f; \
@@ -214,6 +244,21 @@ void PASTEMAC(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( m * m, BLIS_L2_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,ftname,_thread) \
+		( \
+		  ti, nt, uploa, conja, conjx, conjh, m, alpha, a, rs_a, cs_a, \
+		  x, incx, beta, y, incy, cntx \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH(ch,ftname,_unb_ft) f; \
@@ -474,6 +519,21 @@ void PASTEMAC(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( m * m / 2, BLIS_L2_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,opname,_thread) \
+		( \
+		  ti, nt, uploa, transa, diaga, m, alpha, a, rs_a, cs_a, \
+		  x, incx, cntx \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH(ch,ftname,_unb_ft) f; \
@@ -506,6 +566,78 @@ void PASTEMAC(ch,opname,EX_SUF) \
 }
 
 INSERT_GENTFUNC_BASIC( trmv, trmv, trmv_unf_var1, trmv_unf_var2 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, ftname, rvarname, cvarname ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Declare a void function pointer for the current operation. */ \
+	PASTECH(ch,ftname,_unb_ft) f; \
+\
+	/* Choose the underlying implementation. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,rvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,cvarname); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,cvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,rvarname); \
+	} \
+\
+	/* Invoke the variant chosen above, which loops over a level-1v or
+	   level-1f kernel to implement the current operation. */ \
+	f \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  ( ctype* )alpha, \
+	  ( ctype* )a, rs_a, cs_a, \
+	            x, incx, \
+	  ( cntx_t* )cntx \
+	); \
+}
+
 INSERT_GENTFUNC_BASIC( trsv, trmv, trsv_unf_var1, trsv_unf_var2 )
 
 
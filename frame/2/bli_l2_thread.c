@@ -0,0 +1,530 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Define the parameter structures passed to each thread.
+//
+
+typedef struct
+{
+	      trans_t transa;
+	      conj_t  conjx;
+	      dim_t   m;
+	      dim_t   n;
+	const void*   alpha;
+	const void*   a; inc_t rs_a; inc_t cs_a;
+	const void*   x; inc_t incx;
+	const void*   beta;
+	      void*   y; inc_t incy;
+	const cntx_t* cntx;
+} gemv_thread_params_t;
+
+typedef struct
+{
+	      conj_t  conjx;
+	      conj_t  conjy;
+	      dim_t   m;
+	      dim_t   n;
+	const void*   alpha;
+	const void*   x; inc_t incx;
+	const void*   y; inc_t incy;
+	      void*   a; inc_t rs_a; inc_t cs_a;
+	const cntx_t* cntx;
+} ger_thread_params_t;
+
+typedef struct
+{
+	      conj_t  conja;
+	      conj_t  conjx;
+	      conj_t  conjh;
+	      dim_t   m;
+	const void*   alpha;
+	const void*   a; inc_t rs_a; inc_t cs_a;
+	const void*   x; inc_t incx;
+	const void*   beta;
+	      void*   y; inc_t incy;
+	const cntx_t* cntx;
+} hemv_thread_params_t;
+
+typedef struct
+{
+	      uplo_t  uploa;
+	      conj_t  conja;
+	      diag_t  diaga;
+	      dim_t   m;
+	const void*   alpha;
+	const void*   a; inc_t rs_a; inc_t cs_a;
+	      void*   x; inc_t incx;
+	const void*   xt;
+	const cntx_t* cntx;
+} trmv_thread_params_t;
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_l2_thread_tri_bound
+     (
+       dim_t  t,
+       dim_t  nt,
+       dim_t  m,
+       dim_t  bf,
+       uplo_t uplo
+     )
+{
+	if ( t <= 0  ) return 0;
+	if ( t >= nt ) return m;
+
+	// The number of elements in the first i rows of a lower triangular
+	// matrix is proportional to i^2, so we place the boundary between the
+	// rows of threads t-1 and t at m * sqrt( t / nt ) (and reflect this
+	// for upper triangular matrices), rounded down to a multiple of bf.
+	const double frac = bli_is_lower( uplo )
+	                    ?       sqrt( ( double )t          / ( double )nt )
+	                    : 1.0 - sqrt( ( double )( nt - t ) / ( double )nt );
+	const dim_t  bound = ( ( dim_t )( frac * ( double )m ) / bf ) * bf;
+
+	return bli_min( bound, m );
+}
+
+static void bli_l2_thread_range_tri
+     (
+       dim_t  tid,
+       dim_t  nt,
+       dim_t  m,
+       dim_t  bf,
+       uplo_t uplo,
+       dim_t* start,
+       dim_t* end
+     )
+{
+	*start = bli_l2_thread_tri_bound( tid,     nt, m, bf, uplo );
+	*end   = bli_l2_thread_tri_bound( tid + 1, nt, m, bf, uplo );
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const gemv_thread_params_t* params = params_void; \
+\
+	const dim_t   nt   = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf   = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+\
+	const ctype*  a    = params->a; \
+	      ctype*  y    = params->y; \
+	const inc_t   rs_a = params->rs_a; \
+	const inc_t   cs_a = params->cs_a; \
+	const inc_t   incy = params->incy; \
+\
+	dim_t m_y, n_x; \
+	dim_t start, end; \
+\
+	/* Partition the elements of y among the threads. Each partition is a
+	   multiple of a cache line in length (if y is contiguous) so that no
+	   two threads write to the same cache line. */ \
+	bli_set_dims_with_trans( params->transa, params->m, params->n, &m_y, &n_x ); \
+	bli_thread_range_sub( tid, nt, m_y, bf, FALSE, &start, &end ); \
+\
+	const ctype* a1 = bli_does_notrans( params->transa ) ? a + start*rs_a \
+	                                                     : a + start*cs_a; \
+	const dim_t  m1 = bli_does_notrans( params->transa ) ? end - start : params->m; \
+	const dim_t  n1 = bli_does_notrans( params->transa ) ? params->n   : end - start; \
+\
+	PASTEMAC(ch,gemv_ex) \
+	( \
+	  params->transa, \
+	  params->conjx, \
+	  m1, \
+	  n1, \
+	  params->alpha, \
+	  a1, rs_a, cs_a, \
+	  params->x, params->incx, \
+	  params->beta, \
+	  y + start*incy, incy, \
+	  params->cntx, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t ti, \
+             dim_t   nt, \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	gemv_thread_params_t params = \
+	{ \
+	  transa, conjx, m, n, \
+	  alpha, a, rs_a, cs_a, x, incx, beta, y, incy, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( gemv_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const ger_thread_params_t* params = params_void; \
+\
+	const dim_t   nt   = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf   = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+\
+	const ctype*  x    = params->x; \
+	const ctype*  y    = params->y; \
+	      ctype*  a    = params->a; \
+	const inc_t   rs_a = params->rs_a; \
+	const inc_t   cs_a = params->cs_a; \
+\
+	dim_t start, end; \
+\
+	/* Partition the rows (if A is row-stored) or columns (otherwise) of A
+	   among the threads so that each thread updates whole vectors of A. */ \
+	if ( bli_is_row_stored( rs_a, cs_a ) ) \
+	{ \
+		bli_thread_range_sub( tid, nt, params->m, bf, FALSE, &start, &end ); \
+\
+		PASTEMAC(ch,ger_ex) \
+		( \
+		  params->conjx, params->conjy, \
+		  end - start, params->n, \
+		  params->alpha, \
+		  x + start*params->incx, params->incx, \
+		  y, params->incy, \
+		  a + start*rs_a, rs_a, cs_a, \
+		  params->cntx, \
+		  NULL  \
+		); \
+	} \
+	else \
+	{ \
+		bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+		PASTEMAC(ch,ger_ex) \
+		( \
+		  params->conjx, params->conjy, \
+		  params->m, end - start, \
+		  params->alpha, \
+		  x, params->incx, \
+		  y + start*params->incy, params->incy, \
+		  a + start*cs_a, rs_a, cs_a, \
+		  params->cntx, \
+		  NULL  \
+		); \
+	} \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t ti, \
+             dim_t   nt, \
+             conj_t  conjx, \
+             conj_t  conjy, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  y, inc_t incy, \
+             ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ger_thread_params_t params = \
+	{ \
+	  conjx, conjy, m, n, \
+	  alpha, x, incx, y, incy, a, rs_a, cs_a, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( ger_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const hemv_thread_params_t* params = params_void; \
+\
+	const dim_t   nt    = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf    = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+\
+	ctype*        one   = PASTEMAC(ch,1); \
+\
+	const conj_t  conja = params->conja; \
+	const conj_t  conjx = params->conjx; \
+	const conj_t  conjh = params->conjh; \
+	const dim_t   m     = params->m; \
+	const ctype*  a     = params->a; \
+	const ctype*  x     = params->x; \
+	      ctype*  y     = params->y; \
+	const inc_t   rs_a  = params->rs_a; \
+	const inc_t   cs_a  = params->cs_a; \
+	const inc_t   incx  = params->incx; \
+	const inc_t   incy  = params->incy; \
+	const cntx_t* cntx  = params->cntx; \
+\
+	dim_t i0, i1; \
+\
+	/* Partition the elements of y among the threads. Since A is Hermitian
+	   (or symmetric), every row of A contains the same number of elements,
+	   and so the work is balanced by giving each thread the same number of
+	   rows. The launching function has already arranged for A to be stored
+	   in the lower triangle. */ \
+	bli_thread_range_sub( tid, nt, m, bf, FALSE, &i0, &i1 ); \
+\
+	const dim_t   m1    = i1 - i0; \
+\
+	const ctype*  a10   = a + i0*rs_a; \
+	const ctype*  a11   = a + i0*rs_a + i0*cs_a; \
+	const ctype*  a21   = a + i1*rs_a + i0*cs_a; \
+	const ctype*  x0    = x; \
+	const ctype*  x1    = x + i0*incx; \
+	const ctype*  x2    = x + i1*incx; \
+	      ctype*  y1    = y + i0*incy; \
+\
+	/* The rows [i0,i1) of A consist of A10, which is stored; A11, which
+	   is Hermitian (or symmetric); and the (conjugate-)transpose of A21. */ \
+	const trans_t trans10 = bli_is_conj( conja ) \
+	                        ? BLIS_CONJ_NO_TRANSPOSE : BLIS_NO_TRANSPOSE; \
+	const trans_t trans21 = bli_is_conj( bli_apply_conj( conjh, conja ) ) \
+	                        ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE; \
+\
+	/* y1 = beta * y1 + alpha * A11 * x1; */ \
+	if ( bli_is_conj( conjh ) ) \
+		PASTEMAC(ch,hemv_ex) \
+		( \
+		  BLIS_LOWER, conja, conjx, m1, \
+		  params->alpha, a11, rs_a, cs_a, x1, incx, \
+		  params->beta, y1, incy, cntx, NULL \
+		); \
+	else \
+		PASTEMAC(ch,symv_ex) \
+		( \
+		  BLIS_LOWER, conja, conjx, m1, \
+		  params->alpha, a11, rs_a, cs_a, x1, incx, \
+		  params->beta, y1, incy, cntx, NULL \
+		); \
+\
+	/* y1 = y1 + alpha * A10 * x0; */ \
+	PASTEMAC(ch,gemv_ex) \
+	( \
+	  trans10, conjx, m1, i0, \
+	  params->alpha, a10, rs_a, cs_a, x0, incx, \
+	  one, y1, incy, cntx, NULL \
+	); \
+\
+	/* y1 = y1 + alpha * A21^T * x2; (or A21^H) */ \
+	PASTEMAC(ch,gemv_ex) \
+	( \
+	  trans21, conjx, m - i1, m1, \
+	  params->alpha, a21, rs_a, cs_a, x2, incx, \
+	  one, y1, incy, cntx, NULL \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t ti, \
+             dim_t   nt, \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	/* If A is stored in the upper triangle, view its transpose, which is
+	   stored in the lower triangle. For Hermitian A, the transpose is the
+	   same as the conjugate, and so we also toggle the conjugation of A. */ \
+	if ( bli_is_upper( uploa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		conja = bli_apply_conj( conjh, conja ); \
+	} \
+\
+	hemv_thread_params_t params = \
+	{ \
+	  conja, conjx, conjh, m, \
+	  alpha, a, rs_a, cs_a, x, incx, beta, y, incy, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( hemv_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const trmv_thread_params_t* params = params_void; \
+\
+	const dim_t   nt    = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t   bf    = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+\
+	ctype*        one   = PASTEMAC(ch,1); \
+\
+	const uplo_t  uploa = params->uploa; \
+	const dim_t   m     = params->m; \
+	const ctype*  a     = params->a; \
+	      ctype*  x     = params->x; \
+	const ctype*  xt    = params->xt; \
+	const inc_t   rs_a  = params->rs_a; \
+	const inc_t   cs_a  = params->cs_a; \
+	const inc_t   incx  = params->incx; \
+	const cntx_t* cntx  = params->cntx; \
+\
+	dim_t i0, i1; \
+\
+	/* Partition the elements of x among the threads such that each thread
+	   is assigned roughly the same number of elements of A. The launching
+	   function has already arranged for A to be non-transposed. */ \
+	bli_l2_thread_range_tri( tid, nt, m, bf, uploa, &i0, &i1 ); \
+\
+	const dim_t   m1     = i1 - i0; \
+	const ctype*  a11    = a + i0*rs_a + i0*cs_a; \
+	      ctype*  x1     = x + i0*incx; \
+	const trans_t transa = bli_is_conj( params->conja ) \
+	                       ? BLIS_CONJ_NO_TRANSPOSE : BLIS_NO_TRANSPOSE; \
+\
+	/* x1 = alpha * A11 * x1; */ \
+	PASTEMAC(ch,trmv_ex) \
+	( \
+	  uploa, transa, params->diaga, m1, \
+	  params->alpha, a11, rs_a, cs_a, x1, incx, \
+	  cntx, NULL \
+	); \
+\
+	/* Since other threads overwrite the rest of x, the remaining terms are
+	   computed using the copy of the original x, xt. */ \
+	if ( bli_is_lower( uploa ) ) \
+	{ \
+		/* x1 = x1 + alpha * A10 * xt0; */ \
+		PASTEMAC(ch,gemv_ex) \
+		( \
+		  transa, BLIS_NO_CONJUGATE, m1, i0, \
+		  params->alpha, a + i0*rs_a, rs_a, cs_a, xt, 1, \
+		  one, x1, incx, cntx, NULL \
+		); \
+	} \
+	else \
+	{ \
+		/* x1 = x1 + alpha * A12 * xt2; */ \
+		PASTEMAC(ch,gemv_ex) \
+		( \
+		  transa, BLIS_NO_CONJUGATE, m1, m - i1, \
+		  params->alpha, a + i0*rs_a + i1*cs_a, rs_a, cs_a, xt + i1, 1, \
+		  one, x1, incx, cntx, NULL \
+		); \
+	} \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t ti, \
+             dim_t   nt, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	err_t r_val; \
+\
+	/* If A is transposed, view the transpose explicitly. */ \
+	if ( bli_does_trans( transa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		bli_toggle_uplo( &uploa ); \
+	} \
+\
+	/* Since x is updated in place, each thread needs the original contents
+	   of the parts of x that are updated by other threads. Make a copy. */ \
+	ctype* xt = bli_malloc_intl( m * sizeof( ctype ), &r_val ); \
+\
+	PASTEMAC(ch,copyv_ex) \
+	( \
+	  BLIS_NO_CONJUGATE, m, x, incx, xt, 1, cntx, NULL \
+	); \
+\
+	trmv_thread_params_t params = \
+	{ \
+	  uploa, bli_extract_conj( transa ), diaga, m, \
+	  alpha, a, rs_a, cs_a, x, incx, xt, \
+	  cntx \
+	}; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+\
+	bli_free_intl( xt ); \
+}
+
+INSERT_GENTFUNC_BASIC( trmv_thread )
+
@@ -37,6 +37,7 @@
 #include "bli_l3_thrinfo.h"
 #include "bli_l3_decor.h"
 #include "bli_l3_sup_decor.h"
+#include "bli_l3_batch_decor.h"
 
 #include "bli_l3_check.h"
 #include "bli_l3_packab.h"
@@ -57,6 +58,9 @@
 #include "bli_l3_tapi.h"
 #include "bli_l3_tapi_ex.h"
 
+// Prototype batched APIs.
+#include "bli_l3_batch.h"
+
 // Define function types for small/unpacked handlers/kernels.
 #include "bli_l3_sup_oft.h"
 #include "bli_l3_sup_ker_ft.h"
@@ -73,6 +77,7 @@
 #include "bli_l3_sup_vars.h"
 #include "bli_l3_sup_packm.h"
 #include "bli_l3_sup_packm_var.h"
+#include "bli_l3_sup_prepack.h"
 
 // Prototype microkernel wrapper APIs.
 #include "bli_l3_ukr_oapi.h"
@@ -86,3 +91,4 @@
 #include "bli_trmm.h"
 #include "bli_trsm.h"
 #include "bli_gemmt.h"
+#include "bli_i8gemm.h"
@@ -0,0 +1,244 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef struct
+{
+	const obj_t* alpha;
+	const obj_t* a;
+	      inc_t  bs_a;
+	const obj_t* b;
+	      inc_t  bs_b;
+	const obj_t* beta;
+	const obj_t* c;
+	      inc_t  bs_c;
+} l3_batch_strided_params_t;
+
+static void bli_gemm_batch_strided_prob
+     (
+             dim_t  i,
+       const void*  params,
+             obj_t* alpha,
+             obj_t* a,
+             obj_t* b,
+             obj_t* beta,
+             obj_t* c
+     )
+{
+	const l3_batch_strided_params_t* p = params;
+
+	*alpha = *p->alpha;
+	*beta  = *p->beta;
+
+	// Each member of the batch is an alias of the corresponding object that
+	// describes the first member, except that its buffer is offset by i times
+	// the batch stride.
+	bli_obj_alias_to( p->a, a );
+	bli_obj_alias_to( p->b, b );
+	bli_obj_alias_to( p->c, c );
+
+	bli_obj_set_buffer( ( char* )bli_obj_buffer( p->a ) + i * p->bs_a * bli_obj_elem_size( p->a ), a );
+	bli_obj_set_buffer( ( char* )bli_obj_buffer( p->b ) + i * p->bs_b * bli_obj_elem_size( p->b ), b );
+	bli_obj_set_buffer( ( char* )bli_obj_buffer( p->c ) + i * p->bs_c * bli_obj_elem_size( p->c ), c );
+}
+
+//
+// Define object-based batched interfaces.
+//
+
+void bli_gemm_batch_ex
+     (
+             dim_t   n_batch,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t bs_a,
+       const obj_t*  b, inc_t bs_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t bs_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	if ( n_batch <= 0 ) return;
+
+	// Since every member of the batch has the same shape and properties, we
+	// only need to check the operands of the first member.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	// Check for zero dimensions, alpha == 0, or other conditions which
+	// mean that we don't actually have to perform a full l3 operation. These
+	// conditions hold for either all members of the batch or none of them.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	const l3_batch_strided_params_t params =
+	{
+	  .alpha = alpha,
+	  .a     = a, .bs_a = bs_a,
+	  .b     = b, .bs_b = bs_b,
+	  .beta  = beta,
+	  .c     = c, .bs_c = bs_c,
+	};
+
+	bli_l3_batch_thread_decorator
+	(
+	  n_batch,
+	  bli_gemm_batch_strided_prob,
+	  &params,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_gemm_batch
+     (
+             dim_t   n_batch,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t bs_a,
+       const obj_t*  b, inc_t bs_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t bs_c
+     )
+{
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */
+	bli_gemm_batch_ex( n_batch, alpha, a, bs_a, b, bs_b, beta, c, bs_c, NULL, NULL );
+}
+
+//
+// Define BLAS-like batched interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+             dim_t   n_batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_init_finish_1x1( dt, ( void* )alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( void* )beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )b, rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m,   n,            c, rs_c, cs_c, &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemm_batch_ex \
+	( \
+	  n_batch, \
+	  &alphao, \
+	  &ao, bs_a, \
+	  &bo, bs_b, \
+	  &betao, \
+	  &co, bs_c, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch_strided )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+             dim_t   n_batch  \
+     ) \
+{ \
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, \
+	  transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, bs_a, \
+	  b, rs_b, cs_b, bs_b, \
+	  beta, \
+	  c, rs_c, cs_c, bs_c, \
+	  n_batch, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch_strided )
+
@@ -0,0 +1,113 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototype object-based batched interfaces.
+//
+
+// Each of the n_batch members of the batch shares the dimensions, strides,
+// and properties of the objects a, b, and c, which describe the first member.
+// The buffer of the i-th member of A is located i * bs_a elements past that
+// of a (and likewise for B and C). The scalars alpha and beta apply to every
+// member of the batch.
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_ex
+     (
+             dim_t   n_batch,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t bs_a,
+       const obj_t*  b, inc_t bs_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t bs_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_batch
+     (
+             dim_t   n_batch,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t bs_a,
+       const obj_t*  b, inc_t bs_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t bs_c
+     );
+
+//
+// Prototype BLAS-like batched interfaces with typed operands.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+             dim_t   n_batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_batch_strided )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+             dim_t   n_batch  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_batch_strided )
+
@@ -0,0 +1,402 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+
+#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
+
+#endif
+
+struct l3_batch_decor_params_s
+{
+	      l3_batch_prob_ft prob;
+	const void*            prob_params;
+	const dim_t*           list;
+	      dim_t            n_list;
+	const cntx_t*          cntx;
+	const rntm_t*          rntm;
+	      array_t*         array;
+
+	// We insert a cache line of padding here to eliminate false sharing
+	// between the fields above, which are only read, and the counter below,
+	// which is updated by every thread each time it claims a problem.
+	char   padding[ BLIS_CACHE_LINE_SIZE ];
+
+	dim_t  next;
+};
+typedef struct l3_batch_decor_params_s l3_batch_decor_params_t;
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE void bli_l3_batch_prob
+     (
+             dim_t            i,
+             l3_batch_prob_ft prob,
+       const void*            params,
+             obj_t*           alpha,
+             obj_t*           a,
+             obj_t*           b,
+             obj_t*           beta,
+             obj_t*           c
+     )
+{
+	// Statically initialize the objects so that the query function only
+	// needs to finish their initialization.
+	*alpha = ( obj_t )BLIS_OBJECT_INITIALIZER_1X1;
+	*a     = ( obj_t )BLIS_OBJECT_INITIALIZER;
+	*b     = ( obj_t )BLIS_OBJECT_INITIALIZER;
+	*beta  = ( obj_t )BLIS_OBJECT_INITIALIZER_1X1;
+	*c     = ( obj_t )BLIS_OBJECT_INITIALIZER;
+
+	prob( i, params, alpha, a, b, beta, c );
+}
+
+static bool bli_l3_batch_sup_is_ok
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	// This function mirrors the tests performed by bli_gemmsup() and
+	// bli_gemmsup_ref(), so that a batch member takes the small/unpacked
+	// path whenever the same problem would have done so via bli_gemm_ex().
+
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return FALSE;
+	#endif
+
+	if ( !bli_rntm_l3_sup( rntm ) ) return FALSE;
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return FALSE;
+
+	// The sup implementation does not handle general stride.
+	if ( bli_obj_stor3_from_strides( c, a, b ) == BLIS_XXX ) return FALSE;
+
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	// Account for a microkernel preference-induced transposition.
+	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+		return bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx );
+	else
+		return bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx );
+}
+
+static void bli_l3_batch_gemm_seq
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const cntx_t*     cntx,
+       const rntm_t*     rntm,
+             pool_t*     sba_pool,
+             thrinfo_t** thread_sup,
+             thrinfo_t** thread_nat
+     )
+{
+	// Compute one member of the batch using only the current thread. The
+	// thrinfo_t trees are created the first time they are needed and then
+	// kept (along with any packing buffers attached to their nodes) until
+	// the thread has finished its share of the batch. This way, each thread
+	// checks out its packing blocks from the pba once rather than once per
+	// problem.
+
+	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
+		return;
+
+	if ( bli_l3_batch_sup_is_ok( a, b, c, cntx, rntm ) )
+	{
+		const num_t dt = bli_obj_dt( c );
+
+		obj_t alpha_cast, beta_cast;
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, alpha, &alpha_cast );
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, beta, &beta_cast );
+
+		gemmsup_oft gemmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx );
+
+		if ( gemmsup_fp == ( gemmsup_oft )bli_gemmsup_ref )
+		{
+			if ( *thread_sup == NULL )
+				*thread_sup = bli_l3_sup_thrinfo_create( 0, &BLIS_SINGLE_COMM, sba_pool, rntm );
+
+			bli_gemmsup_int( &alpha_cast, a, b, &beta_cast, c, cntx, rntm, *thread_sup );
+			return;
+		}
+
+		// A custom sup handler manages its own threading, so we simply pass
+		// it the single-threaded runtime.
+		rntm_t rntm_l = *rntm;
+		if ( gemmsup_fp( &alpha_cast, a, b, &beta_cast, c, cntx, &rntm_l ) == BLIS_SUCCESS )
+			return;
+	}
+
+	// Default to using native execution.
+	num_t dt = bli_obj_dt( c );
+	ind_t im = BLIS_NAT;
+
+	// If each matrix operand has a complex storage datatype, try to get an
+	// induced method (if one is available and enabled).
+	if ( bli_obj_is_complex( c ) &&
+	     bli_obj_is_complex( a ) &&
+	     bli_obj_is_complex( b ) )
+		im = bli_gemmind_find_avail( dt );
+
+	// Alias A, B, and C in case we need to apply transformations.
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	gemm_cntl_t cntl;
+	bli_gemm_cntl_init
+	(
+	  im,
+	  BLIS_GEMM,
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  beta,
+	  &c_local,
+	  cntx,
+	  &cntl
+	);
+
+	// The shape of the gemm control tree does not depend on the operands,
+	// so a thrinfo_t tree grown from the first problem's control tree may
+	// be used for all subsequent problems.
+	if ( *thread_nat == NULL )
+	{
+		*thread_nat = bli_thrinfo_create_root
+		(
+		  &BLIS_SINGLE_COMM,
+		  0,
+		  sba_pool,
+		  bli_pba_query()
+		);
+
+		bli_l3_thrinfo_grow( *thread_nat, rntm, ( cntl_t* )&cntl );
+	}
+
+	bli_l3_int
+	(
+	  &a_local,
+	  &b_local,
+	  &c_local,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  *thread_nat
+	);
+}
+
+static void bli_l3_batch_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	// NOTE: The params struct is shared by all threads, which update the
+	// problem counter within it, and so we cast away the const qualifier.
+	l3_batch_decor_params_t* data        = ( l3_batch_decor_params_t* )data_void;
+
+	const l3_batch_prob_ft   prob        = data->prob;
+	const void*              prob_params = data->prob_params;
+	const dim_t*             list        = data->list;
+	const dim_t              n_list      = data->n_list;
+	const cntx_t*            cntx        = data->cntx;
+	      rntm_t             rntm_l      = *data->rntm;
+	      array_t*           array       = data->array;
+
+	bli_l3_thread_decorator_thread_check( gl_comm, &rntm_l );
+
+	pool_t*    sba_pool   = bli_sba_array_elem( tid, array );
+	thrinfo_t* thread_sup = NULL;
+	thrinfo_t* thread_nat = NULL;
+
+	// Each thread claims the next unclaimed problem until none remain. This
+	// balances the load even when the members of the batch vary in size.
+	while ( TRUE )
+	{
+		const dim_t j = __atomic_fetch_add( &data->next, 1, __ATOMIC_RELAXED );
+
+		if ( n_list <= j ) break;
+
+		obj_t alpha, a, b, beta, c;
+		bli_l3_batch_prob( list[ j ], prob, prob_params, &alpha, &a, &b, &beta, &c );
+
+		bli_l3_batch_gemm_seq
+		(
+		  &alpha, &a, &b, &beta, &c,
+		  cntx,
+		  &rntm_l,
+		  sba_pool,
+		  &thread_sup,
+		  &thread_nat
+		);
+	}
+
+	// Free the thrinfo_t trees, which also releases the packing blocks
+	// acquired by this thread back to the pba.
+	bli_thrinfo_free( thread_sup );
+	bli_thrinfo_free( thread_nat );
+}
+
+void bli_l3_batch_thread_decorator
+     (
+             dim_t            n_batch,
+             l3_batch_prob_ft prob,
+       const void*            params,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     )
+{
+	if ( n_batch <= 0 ) return;
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Query the threading implementation and the number of threads requested.
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		// Favor the requested threading implementation over the number of
+		// threads, as is done in bli_l3_thread_decorator().
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// Sort the members of the batch into two lists. A problem whose share of
+	// the total flop count is at least that of one thread is "large" and is
+	// computed by all threads, one problem at a time, via bli_gemm_ex(). All
+	// other problems are "small" and are distributed across the threads, with
+	// each problem computed in its entirety by a single thread. The small
+	// problems are stored at the front of list and the large problems at the
+	// back.
+	err_t  r_val;
+	dim_t* list    = bli_malloc_intl( sizeof( dim_t ) * n_batch, &r_val );
+	dim_t  n_small = 0;
+	dim_t  n_large = 0;
+
+	double flops_total = 0.0;
+
+	for ( dim_t i = 0; i < n_batch; ++i )
+	{
+		obj_t alpha, a, b, beta, c;
+		bli_l3_batch_prob( i, prob, params, &alpha, &a, &b, &beta, &c );
+
+		flops_total += ( double )bli_obj_length( &c ) *
+		               ( double )bli_obj_width( &c ) *
+		               ( double )bli_obj_width_after_trans( &a );
+	}
+
+	for ( dim_t i = 0; i < n_batch; ++i )
+	{
+		obj_t alpha, a, b, beta, c;
+		bli_l3_batch_prob( i, prob, params, &alpha, &a, &b, &beta, &c );
+
+		const double flops = ( double )bli_obj_length( &c ) *
+		                     ( double )bli_obj_width( &c ) *
+		                     ( double )bli_obj_width_after_trans( &a );
+
+		if ( 1 < nt && 0.0 < flops && flops_total <= flops * nt )
+			list[ n_batch - 1 - n_large++ ] = i;
+		else
+			list[ n_small++ ] = i;
+	}
+
+	if ( 0 < n_small )
+	{
+		// There is no point in launching more threads than there are small
+		// problems.
+		const dim_t nt_small = bli_min( nt, n_small );
+
+		// Each small problem is computed sequentially within one thread.
+		rntm_t rntm_s = rntm_l;
+		bli_rntm_set_num_threads_only( 1, &rntm_s );
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_s );
+		bli_rntm_set_auto_factor_only( FALSE, &rntm_s );
+
+		// Check out an array_t from the small block allocator, which will
+		// provide each thread with its own sba pool.
+		array_t* array = bli_sba_checkout_array( nt_small );
+
+		l3_batch_decor_params_t decor_params;
+		decor_params.prob        = prob;
+		decor_params.prob_params = params;
+		decor_params.list        = list;
+		decor_params.n_list      = n_small;
+		decor_params.cntx        = cntx;
+		decor_params.rntm        = &rntm_s;
+		decor_params.array       = array;
+		decor_params.next        = 0;
+
+		bli_thread_launch( ti, nt_small, bli_l3_batch_thread_decorator_entry, &decor_params );
+
+		bli_sba_checkin_array( array );
+	}
+
+	// Compute the large problems (in their original order) using all of the
+	// threads requested by the caller.
+	for ( dim_t j = n_batch - 1; n_batch - n_large <= j; --j )
+	{
+		obj_t alpha, a, b, beta, c;
+		bli_l3_batch_prob( list[ j ], prob, params, &alpha, &a, &b, &beta, &c );
+
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c, cntx, &rntm_l );
+	}
+
+	bli_free_intl( list );
+}
+
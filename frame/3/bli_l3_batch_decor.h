@@ -0,0 +1,70 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_L3_BATCH_DECOR_H
+#define BLIS_L3_BATCH_DECOR_H
+
+// -- batch definitions --------------------------------------------------------
+
+// Batched gemm problem query function type. Given the index i of a member of
+// the batch, the function initializes the objects that describe the i-th
+// problem, C_i := beta_i * C_i + alpha_i * A_i * B_i, using the opaque params
+// pointer that was passed into the batch thread decorator. The objects are
+// statically initialized (as with BLIS_OBJECT_INITIALIZER and
+// BLIS_OBJECT_INITIALIZER_1X1) prior to the call, and so the function only
+// needs to finish their initialization via bli_obj_init_finish() and
+// bli_obj_init_finish_1x1().
+typedef void (*l3_batch_prob_ft)
+     (
+             dim_t  i,
+       const void*  params,
+             obj_t* alpha,
+             obj_t* a,
+             obj_t* b,
+             obj_t* beta,
+             obj_t* c
+     );
+
+// Level-3 batch thread decorator prototype.
+void bli_l3_batch_thread_decorator
+     (
+             dim_t            n_batch,
+             l3_batch_prob_ft prob,
+       const void*            params,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     );
+
+#endif
+
@@ -478,6 +478,11 @@ void bli_hemm_basic_check
 
 	bli_l3_basic_check( alpha, a, b, beta, c, cntx );
 
+	// Half-precision packing is only supported for general matrices, so
+	// the structured operand must be stored in a full floating-point type.
+	e_val = bli_check_floating_object( a );
+	bli_check_error_code( e_val );
+
 	// Check object dimensions.
 
 	if ( bli_is_left( side ) )
@@ -612,10 +617,12 @@ void bli_l3_basic_check
 	e_val = bli_check_noninteger_object( beta );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( a );
+	// The input operands may also be half-precision (bfloat16 or float16)
+	// matrices since those are packed into the computation precision.
+	e_val = bli_check_floating_or_half_object( a );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( b );
+	e_val = bli_check_floating_or_half_object( b );
 	bli_check_error_code( e_val );
 
 	e_val = bli_check_floating_object( c );
@@ -103,6 +103,21 @@ void bli_l3_thread_decorator
 	if ( rntm != NULL ) rntm_l = *rntm;
 	else bli_rntm_init_from_global( &rntm_l );
 
+	// Cap the number of threads for small problems, if it is to be
+	// factorized automatically, based on the amount of work and the
+	// register blocksizes of the computational datatype.
+	const num_t dt_comp = bli_dt_domain( bli_obj_dt( c ) ) | bli_obj_comp_prec( c );
+
+	bli_rntm_limit_num_threads
+	(
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width( a ),
+	  bli_cntx_get_blksz_def_dt( dt_comp, BLIS_MR, cntx ),
+	  bli_cntx_get_blksz_def_dt( dt_comp, BLIS_NR, cntx ),
+	  &rntm_l
+	);
+
 	// Set the number of ways for each loop, if needed, depending on what
 	// kind of information is already stored in the rntm_t object.
 	bli_rntm_factorize
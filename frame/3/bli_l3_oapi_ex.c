@@ -59,22 +59,65 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 {
 	bli_init_once();
 
+	// Query the epilogue (if any) to be fused into the write-back of C.
+	const gemm_epilogue_t* epilogue = rntm ? bli_rntm_epilogue( rntm ) : NULL;
+
+	// Query the prologue (if any) to be fused into the packing of A and B.
+	const gemm_prologue_t* prologue = rntm ? bli_rntm_prologue( rntm ) : NULL;
+	if ( prologue && prologue->func_a == NULL && prologue->func_b == NULL )
+		prologue = NULL;
+
 	// Check the operands.
 	if ( bli_error_checking_is_enabled() )
+	{
 		bli_gemm_check( alpha, a, b, beta, c, cntx );
 
+		if ( epilogue )
+			bli_gemm_epilogue_check( epilogue, c );
+
+		if ( prologue )
+			bli_gemm_prologue_check( prologue, a, b, c );
+	}
+
 	// Check for zero dimensions, alpha == 0, or other conditions which
 	// mean that we don't actually have to perform a full l3 operation.
+	// The epilogue must still be applied to whatever is left in C.
 	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
+	{
+		if ( epilogue ) bli_gemm_epilogue_apply( epilogue, c, cntx );
 		return;
+	}
+
+	// Operands that were packed ahead of time may only be consumed by the
+	// implementation they were packed for: the small/unpacked implementation
+	// for those packed via bli_gemmsup_pack_a() or bli_gemmsup_pack_b(), and
+	// the conventional native implementation for those packed via
+	// bli_gemm_pack_a() or bli_gemm_pack_b().
+	bool sup_prepacked = bli_obj_is_sup_packed( a ) ||
+	                     bli_obj_is_sup_packed( b );
+	bool prepacked     = !sup_prepacked &&
+	                     ( bli_obj_is_panel_packed( a ) ||
+	                       bli_obj_is_panel_packed( b ) );
 
 	// Execute the small/unpacked oapi handler. If it finds that the problem
 	// does not fall within the thresholds that define "small", or for some
 	// other reason decides not to use the small/unpacked implementation,
 	// the function returns with BLIS_FAILURE, which causes execution to
-	// proceed towards the conventional implementation.
-	if ( bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+	// proceed towards the conventional implementation. The sup kernels do
+	// not fuse the epilogue, but C is small enough in this case that a
+	// separate pass over it is cheap. A prologue, on the other hand, can only
+	// be applied by the conventional implementation since it packs A and B.
+	if ( !prepacked && !prologue &&
+	     bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+	{
+		if ( epilogue ) bli_gemm_epilogue_apply( epilogue, c, cntx );
 		return;
+	}
+
+	// The conventional implementation cannot make use of an operand that
+	// was packed for the small/unpacked implementation.
+	if ( sup_prepacked )
+		bli_check_error_code( BLIS_PACKED_OBJECT_REQUIRES_SUP );
 
 	// Default to using native execution.
 	num_t dt = bli_obj_dt( c );
@@ -84,8 +127,10 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	// induced method (if one is available and enabled). NOTE: Allowing
 	// precisions to vary while using 1m, which is what we do here, is unique
 	// to gemm; other level-3 operations use 1m only if all storage datatypes
-	// are equal (and they ignore the computation precision).
-	if ( bli_obj_is_complex( c ) &&
+	// are equal (and they ignore the computation precision). A prologue
+	// requires A and B to be packed in the native format.
+	if ( !prepacked && !prologue &&
+	     bli_obj_is_complex( c ) &&
 	     bli_obj_is_complex( a ) &&
 	     bli_obj_is_complex( b ) )
 	{
@@ -122,7 +167,7 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	bli_obj_alias_submatrix( c, &c_local );
 
 	gemm_cntl_t cntl;
-	bli_gemm_cntl_init
+	bool trans = bli_gemm_cntl_init
 	(
 	  im,
 	  BLIS_GEMM,
@@ -135,6 +180,33 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	  &cntl
 	);
 
+	// Fuse the epilogue into the macro-kernel, noting whether the operation
+	// was transposed so that the epilogue is applied in terms of the
+	// original C.
+	if ( epilogue )
+		bli_gemm_cntl_set_epilogue( epilogue, trans, &cntl );
+
+	// Fuse the prologue into the packing of A and B, which are always packed
+	// in the native format here.
+	if ( prologue )
+		bli_gemm_cntl_set_prologue( prologue, trans, &cntl );
+
+	// Let the threads sharing the macro-kernel claim microtiles dynamically
+	// if this was requested via the runtime (or, absent one, the global
+	// settings that the thread decorator would otherwise use).
+	rntm_t rntm_g;
+	if ( rntm == NULL )
+	{
+		bli_rntm_init_from_global( &rntm_g );
+		rntm = &rntm_g;
+	}
+	bli_gemm_cntl_set_jrir_dyn( bli_rntm_jrir_dyn( rntm ), &cntl );
+
+	// Verify that any pre-packed operands are compatible with the control
+	// tree and arrange for them to be used without repacking.
+	if ( prepacked )
+		bli_gemm_prepacked_init( &a_local, &b_local, &cntl );
+
 	// Invoke the internal back-end via the thread handler.
 	bli_l3_thread_decorator
 	(
@@ -50,16 +50,26 @@ err_t bli_gemmsup
 	return BLIS_FAILURE;
 	#endif
 
-	// Return early if this is a mixed-datatype computation.
-	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
-	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
-	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
-
 	// Obtain a valid (native) context from the gks if necessary.
 	// NOTE: This must be done before calling the _check() function, since
 	// that function assumes the context pointer is valid.
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
 
+	// Operands that were packed via bli_gemmsup_pack_a() or
+	// bli_gemmsup_pack_b() can only be consumed by this code path, so we
+	// verify that they are compatible with the current operation and then
+	// bypass the thresholds (and the runtime's sup setting) below.
+	const bool prepacked = bli_obj_is_sup_packed( a ) ||
+	                       bli_obj_is_sup_packed( b );
+
+	if ( prepacked )
+		bli_gemmsup_prepacked_check( a, b, c, cntx );
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
 	const num_t dt = bli_obj_dt( c );
 	const dim_t m  = bli_obj_length( c );
 	const dim_t n  = bli_obj_width( c );
@@ -68,7 +78,11 @@ err_t bli_gemmsup
 	// Return early if a microkernel preference-induced transposition would
 	// have been performed and shifted the dimensions outside of the space
 	// of sup-handled problems.
-	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+	if ( prepacked )
+	{
+		// Pre-packed operands are always handled here.
+	}
+	else if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
 	{
 		// Pass in m and n reversed, which simulates a transposition of the
 		// entire operation pursuant to the microkernel storage preference.
@@ -87,9 +101,29 @@ err_t bli_gemmsup
 	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
 	else                { rntm_l = *rntm;                       }
 
-	if ( !bli_rntm_l3_sup( &rntm_l ) )
+	if ( !prepacked && !bli_rntm_l3_sup( &rntm_l ) )
 		return BLIS_FAILURE;
 
+	// The small/unpacked implementation does not parallelize the pc loop, so
+	// leave problems whose k dimension would be parallelized (whether by
+	// request or by automatic factorization) to the conventional
+	// implementation.
+	if ( !prepacked )
+	{
+		rntm_t rntm_f = rntm_l;
+		bli_rntm_limit_num_threads
+		(
+		  m, n, k,
+		  bli_cntx_get_blksz_def_dt( dt, BLIS_MR_SUP, cntx ),
+		  bli_cntx_get_blksz_def_dt( dt, BLIS_NR_SUP, cntx ),
+		  &rntm_f
+		);
+		bli_rntm_factorize( m, n, k, &rntm_f );
+
+		if ( bli_rntm_pc_ways( &rntm_f ) > 1 )
+			return BLIS_FAILURE;
+	}
+
 #if 0
 const num_t dt = bli_obj_dt( c );
 const dim_t m  = bli_obj_length( c );
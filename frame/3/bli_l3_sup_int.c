@@ -76,7 +76,29 @@ err_t bli_gemmsup_int
 	return BLIS_SUCCESS;
 #endif
 
-	const stor3_t stor_id = bli_obj_stor3_from_strides( c, a, b );
+	// Operands that were packed via bli_gemmsup_pack_a() or
+	// bli_gemmsup_pack_b() cannot be transposed into the other operand's
+	// role, so the operation is always handled as-is, with a millikernel
+	// that expects row-stored B. (The variants pack B if it was neither
+	// pre-packed nor row-stored.) C and A keep their actual storage, except
+	// that column-stored C and A, which would otherwise call for such a
+	// transposition, use the kernel for column-stored C and row-stored A.
+	// That kernel also accepts column-stored A, since this is the format
+	// to which the variants pack A.
+	const bool    prepacked  = bli_obj_is_sup_packed( a ) ||
+	                           bli_obj_is_sup_packed( b );
+
+	      stor3_t stor_id    = bli_obj_stor3_from_strides( c, a, b );
+
+	if ( prepacked )
+	{
+		const bool row_a = ( bli_obj_has_notrans( a ) ? bli_obj_is_row_stored( a )
+		                                              : bli_obj_is_col_stored( a ) );
+
+		if      ( !bli_obj_is_row_stored( c ) ) stor_id = BLIS_CRR;
+		else if ( row_a )                       stor_id = BLIS_RRR;
+		else                                    stor_id = BLIS_RCR;
+	}
 
 	const bool    is_rrr_rrc_rcr_crr = ( stor_id == BLIS_RRR ||
 	                                     stor_id == BLIS_RRC ||
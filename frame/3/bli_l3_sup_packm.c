@@ -237,3 +237,23 @@ void bli_packm_sup
 	bli_thrinfo_barrier( thread );
 }
 
+void bli_packm_sup_prepacked
+     (
+             dim_t  mr,
+       const void*  a, inc_t  rs_a, inc_t  cs_a,
+             void** p, inc_t* rs_p, inc_t* cs_p,
+                       inc_t* ps_p
+     )
+{
+	// Set the parameters for use with a matrix that was packed ahead of time
+	// via bli_gemmsup_pack_a() or bli_gemmsup_pack_b(). The caller indexes
+	// the pre-packed matrix with rs_a set to the panel stride divided by
+	// mr, so that a points to the appropriate micropanel, offset to the
+	// current k iteration.
+	*rs_p = 1;
+	*cs_p = cs_a;
+	*ps_p = mr * rs_a;
+
+	*p = ( void* )a;
+}
+
@@ -56,3 +56,11 @@ void bli_packm_sup
              thrinfo_t* thread
      );
 
+void bli_packm_sup_prepacked
+     (
+             dim_t  mr,
+       const void*  a, inc_t  rs_a, inc_t  cs_a,
+             void** p, inc_t* rs_p, inc_t* cs_p,
+                       inc_t* ps_p
+     );
+
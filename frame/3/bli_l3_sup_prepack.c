@@ -0,0 +1,257 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static void bli_gemmsup_pack_int
+     (
+             side_t  side,
+       const obj_t*  x,
+             obj_t*  xp,
+       const cntx_t* cntx
+     )
+{
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_floating_object( x );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_matrix_object( x );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( x );
+		bli_check_error_code( e_val );
+	}
+
+	// Mirror bli_gemmsup_ref_var2m(): A is packed as-is into micropanels of
+	// MR rows, while B is packed via its transpose into micropanels of NR
+	// columns.
+	obj_t x_local;
+	bli_obj_alias_to( x, &x_local );
+	if ( side == BLIS_LEFT )
+	{
+		if ( bli_obj_has_trans( x ) )
+		{
+			bli_obj_induce_trans( &x_local );
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &x_local );
+		}
+	}
+	else
+	{
+		if ( bli_obj_has_trans( x ) )
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &x_local );
+		else
+			bli_obj_induce_trans( &x_local );
+	}
+
+	const num_t     dt       = bli_obj_dt( x );
+	const dim_t     m        = bli_obj_length( &x_local );
+	const dim_t     k        = bli_obj_width( &x_local );
+	const dim_t     mr       = bli_cntx_get_l3_sup_blksz_def_dt
+	                           ( dt, side == BLIS_LEFT ? BLIS_MR : BLIS_NR, cntx );
+	const packbuf_t buf_type = side == BLIS_LEFT ? BLIS_BUFFER_FOR_A_BLOCK
+	                                             : BLIS_BUFFER_FOR_B_PANEL;
+
+	// A sub-configuration that does not provide sup blocksizes for this
+	// datatype never uses the sup code path for it.
+	if ( mr <= 0 )
+		bli_check_error_code( BLIS_PACKED_OBJECT_REQUIRES_SUP );
+
+	// Allocate room for the entire matrix, with the last micropanel padded
+	// out to a full MR (or NR), just as bli_packm_sup() would. Since the
+	// entire k dimension is packed at once, each micropanel spans the full
+	// k dimension of x, which allows the packed matrix to be used with any
+	// KC blocksize.
+	const dim_t m_pack = ( m / mr + ( m % mr ? 1 : 0 ) ) * mr;
+	const siz_t size_p = bli_dt_size( dt ) * m_pack * k;
+
+	err_t r_val;
+	void* buf_p  = size_p != 0 ? bli_malloc_user( size_p, &r_val ) : NULL;
+
+	// Create a single-threaded thrinfo_t node and give it the buffer we
+	// just allocated, so that bli_packm_sup() packs into that buffer
+	// instead of acquiring a block from the pba.
+	thrinfo_t* thread = bli_thrinfo_create_root( &BLIS_SINGLE_COMM, 0, NULL, NULL );
+	mem_t*     mem_p  = bli_thrinfo_mem( thread );
+
+	bli_mem_set_buffer( buf_p, mem_p );
+	bli_mem_set_size( size_p, mem_p );
+	bli_mem_set_buf_type( buf_type, mem_p );
+	bli_mem_set_pool( NULL, mem_p );
+
+	// Any stor3_t id other than BLIS_RRC or BLIS_CRC selects packing to
+	// column-stored micropanels, which is the format that the sup variants
+	// consume pre-packed operands in. Conjugation is not applied here, but
+	// rather recorded in the packed object, since the sup millikernels
+	// apply it.
+	void* p;
+	inc_t rs_p, cs_p, ps_p;
+
+	bli_packm_sup
+	(
+	  TRUE,
+	  buf_type,
+	  BLIS_RRR,
+	  dt,
+	  m, k, mr,
+	  bli_obj_buffer_for_const( dt, &BLIS_ONE ),
+	  bli_obj_buffer_at_off( &x_local ),
+	  bli_obj_row_stride( &x_local ), bli_obj_col_stride( &x_local ),
+	  &p, &rs_p, &cs_p,
+	      &ps_p,
+	  cntx,
+	  thread
+	);
+
+	// Detach the buffer so that bli_thrinfo_free() does not try to return
+	// it to the pba.
+	bli_mem_clear( mem_p );
+	bli_thrinfo_free( thread );
+
+	// Describe the packed matrix. Note that xp owns buf_p.
+	bli_obj_create_without_buffer( dt, m, k, xp );
+	bli_obj_set_buffer( buf_p, xp );
+	bli_obj_set_strides( rs_p, cs_p, xp );
+	bli_obj_set_conj( bli_obj_conj_status( x ), xp );
+	bli_obj_set_padded_dims( m_pack, k, xp );
+	bli_obj_set_panel_dims( mr, k, xp );
+	bli_obj_set_panel_dim( mr, xp );
+	bli_obj_set_panel_stride( ps_p, xp );
+	bli_obj_set_pack_schema( BLIS_PACKED_PANELS_SUP, xp );
+
+	// Transpose the packed copy of B^T back to B.
+	if ( side == BLIS_RIGHT )
+		bli_obj_induce_trans( xp );
+}
+
+void bli_gemmsup_pack_a
+     (
+       const obj_t*  a,
+             obj_t*  ap,
+       const cntx_t* cntx
+     )
+{
+	bli_gemmsup_pack_int( BLIS_LEFT, a, ap, cntx );
+}
+
+void bli_gemmsup_pack_b
+     (
+       const obj_t*  b,
+             obj_t*  bp,
+       const cntx_t* cntx
+     )
+{
+	bli_gemmsup_pack_int( BLIS_RIGHT, b, bp, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gemmsup_prepacked_check_operand
+     (
+       const obj_t*  x,
+             num_t   dt,
+             bszid_t bszid,
+       const cntx_t* cntx
+     )
+{
+	// The datatype and register blocksize were recorded in the object when
+	// it was packed. They must agree with those of the current operation.
+	// The micropanels must also span the entire k dimension of x, which
+	// also rules out a transposed view of the packed matrix.
+	const dim_t pd = bli_obj_panel_dim( x );
+
+	if ( bli_obj_dt( x )         != dt ||
+	     pd                      != bli_cntx_get_l3_sup_blksz_def_dt( dt, bszid, cntx ) ||
+	     bli_obj_row_stride( x ) != 1 ||
+	     bli_obj_col_stride( x ) != pd ||
+	     bli_obj_panel_stride( x ) != pd * bli_obj_width( x ) )
+		bli_check_error_code( BLIS_PACKED_OBJECT_BLKSZ_MISMATCH );
+}
+
+void bli_gemmsup_prepacked_check
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+
+	// A pre-packed matrix must be used in its entirety and exactly as it was
+	// packed. (Conjugation is permitted since it was never applied to the
+	// packed matrix.)
+	if ( bli_obj_has_trans( a ) ||
+	     bli_obj_row_off( a ) != 0 || bli_obj_col_off( a ) != 0 ||
+	     bli_obj_has_trans( b ) ||
+	     bli_obj_row_off( b ) != 0 || bli_obj_col_off( b ) != 0 )
+	{
+		if ( bli_obj_is_packed( a ) || bli_obj_is_packed( b ) )
+			bli_check_error_code( BLIS_INVALID_PACKED_OBJECT_VIEW );
+	}
+
+	// An operand packed for the conventional implementation cannot be
+	// combined with one packed for the small/unpacked implementation.
+	if ( ( bli_obj_is_packed( a ) && !bli_obj_is_sup_packed( a ) ) ||
+	     ( bli_obj_is_packed( b ) && !bli_obj_is_sup_packed( b ) ) )
+		bli_check_error_code( BLIS_PACKED_OBJECT_BLKSZ_MISMATCH );
+
+	if ( bli_obj_is_sup_packed( a ) )
+	{
+		bli_gemmsup_prepacked_check_operand( a, dt, BLIS_MR, cntx );
+	}
+
+	if ( bli_obj_is_sup_packed( b ) )
+	{
+		// The pre-packed matrix stores micropanels of B^T.
+		obj_t bt;
+		bli_obj_alias_to( b, &bt );
+		bli_obj_induce_trans( &bt );
+
+		bli_gemmsup_prepacked_check_operand( &bt, dt, BLIS_NR, cntx );
+	}
+
+	// The sup variants consume pre-packed operands with the millikernels
+	// of the row-preferential kernel group (see bli_gemmsup_int()).
+	if ( !bli_cntx_ukr_prefers_rows_dt( dt, bli_stor3_ukr( BLIS_RRR ), cntx ) )
+		bli_check_error_code( BLIS_PACKED_OBJECT_REQUIRES_SUP );
+}
+
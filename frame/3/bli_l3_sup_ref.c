@@ -63,8 +63,19 @@ err_t bli_gemmsup_ref
 	const stor3_t stor_id = bli_obj_stor3_from_strides( c, a, b );
 	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE;
 
-	// Parse and interpret the contents of the rntm_t object to properly
-	// set the ways of parallelism for each loop.
+	// Cap the number of threads for small problems (see
+	// bli_l3_thread_decorator()), then parse and interpret the contents of
+	// the rntm_t object to properly set the ways of parallelism for each
+	// loop.
+	bli_rntm_limit_num_threads
+	(
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width( a ),
+	  bli_cntx_get_blksz_def_dt( bli_obj_dt( c ), BLIS_MR_SUP, cntx ),
+	  bli_cntx_get_blksz_def_dt( bli_obj_dt( c ), BLIS_NR_SUP, cntx ),
+	  rntm
+	);
 	bli_rntm_factorize_sup
 	(
 	  bli_obj_length( c ),
@@ -137,8 +148,19 @@ err_t bli_gemmtsup_ref
 	}
 #endif
 
-	// Parse and interpret the contents of the rntm_t object to properly
-	// set the ways of parallelism for each loop.
+	// Cap the number of threads for small problems (see
+	// bli_l3_thread_decorator()), then parse and interpret the contents of
+	// the rntm_t object to properly set the ways of parallelism for each
+	// loop.
+	bli_rntm_limit_num_threads
+	(
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width( a ),
+	  bli_cntx_get_blksz_def_dt( bli_obj_dt( c ), BLIS_MR_SUP, cntx ),
+	  bli_cntx_get_blksz_def_dt( bli_obj_dt( c ), BLIS_NR_SUP, cntx ),
+	  rntm
+	);
 	bli_rntm_factorize_sup
 	(
 	  bli_obj_length( c ),
@@ -110,9 +110,28 @@ void bli_gemmsup_ref_var1n
 	const void* buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
 	const void* buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
 
+	// Operands that were packed ahead of time via bli_gemmsup_pack_a() or
+	// bli_gemmsup_pack_b() are stepped through one micropanel at a time in
+	// the m (or n) dimension, so we substitute the panel stride (in units
+	// of micropanel rows) for the row (or column) stride.
+	const bool prepacka = bli_obj_is_sup_packed( a );
+	const bool prepackb = bli_obj_is_sup_packed( b );
+
+	if ( prepacka || prepackb )
+	{
+		if ( prepacka ) { packa = TRUE; rs_a = bli_obj_panel_stride( a ) / bli_obj_panel_dim( a ); }
+		if ( prepackb ) { packb = TRUE; cs_b = bli_obj_panel_stride( b ) / bli_obj_panel_dim( b ); }
+
+		// bli_gemmsup_int() chose a millikernel that expects row-stored B,
+		// so pack B if it was not pre-packed and is not row-stored.
+		if ( !prepackb && cs_b != 1 ) packb = TRUE;
+	}
+
 #if 1
 	// Optimize some storage/packing cases by transforming them into others.
 	// These optimizations are expressed by changing trans and/or stor_id.
+	// (Pre-packed operands rule out any such transformation.)
+	if ( !prepacka && !prepackb )
 	bli_gemmsup_ref_var1n2m_opt_cases( dt, &trans, packa, packb, &stor_id, cntx );
 #endif
 
@@ -294,20 +313,33 @@ void bli_gemmsup_ref_var1n
 			// implementation based on the schema deduced from the stor_id.
 			// NOTE: packing matrix A in this panel-block algorithm corresponds
 			// to packing matrix B in the block-panel algorithm.
-			bli_packm_sup
-			(
-			  packa,
-			  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix A to
-			  stor_id,                 // a "panel of B".
-			  dt,
-			  nc_cur, kc_cur, MR,
-			  one,
-			  a_pc,   rs_a,      cs_a,
-			  ( void** )&a_use, &rs_a_use, &cs_a_use,
-			                    &ps_a_use,
-			  cntx,
-			  thread_pa
-			);
+			if ( prepacka )
+			{
+				bli_packm_sup_prepacked
+				(
+				  MR,
+				  a_pc,   rs_a,      cs_a,
+				  ( void** )&a_use, &rs_a_use, &cs_a_use,
+				                    &ps_a_use
+				);
+			}
+			else
+			{
+				bli_packm_sup
+				(
+				  packa,
+				  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix A to
+				  stor_id,                 // a "panel of B".
+				  dt,
+				  nc_cur, kc_cur, MR,
+				  one,
+				  a_pc,   rs_a,      cs_a,
+				  ( void** )&a_use, &rs_a_use, &cs_a_use,
+				                    &ps_a_use,
+				  cntx,
+				  thread_pa
+				);
+			}
 
 			// Alias a_use so that it's clear this is our current block of
 			// matrix A.
@@ -350,20 +382,33 @@ void bli_gemmsup_ref_var1n
 				// implementation based on the schema deduced from the stor_id.
 				// NOTE: packing matrix B in this panel-block algorithm corresponds
 				// to packing matrix A in the block-panel algorithm.
-				bli_packm_sup
-				(
-				  packb,
-				  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix B to
-				  stor_id,                 // a "block of A".
-				  dt,
-				  mc_cur, kc_cur, NR,
-				  one,
-				  b_ic,   cs_b,      rs_b,
-				  ( void** )&b_use, &cs_b_use, &rs_b_use,
-				                    &ps_b_use,
-				  cntx,
-				  thread_pb
-				);
+				if ( prepackb )
+				{
+					bli_packm_sup_prepacked
+					(
+					  NR,
+					  b_ic,   cs_b,      rs_b,
+					  ( void** )&b_use, &cs_b_use, &rs_b_use,
+					                    &ps_b_use
+					);
+				}
+				else
+				{
+					bli_packm_sup
+					(
+					  packb,
+					  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix B to
+					  stor_id,                 // a "block of A".
+					  dt,
+					  mc_cur, kc_cur, NR,
+					  one,
+					  b_ic,   cs_b,      rs_b,
+					  ( void** )&b_use, &cs_b_use, &rs_b_use,
+					                    &ps_b_use,
+					  cntx,
+					  thread_pb
+					);
+				}
 
 				// Alias b_use so that it's clear this is our current block of
 				// matrix B.
@@ -432,19 +477,19 @@ void bli_gemmsup_ref_var1n
 
 			// NOTE: This barrier is only needed if we are packing A (since
 			// that matrix is packed within the pc loop of this variant).
-			if ( packa ) bli_thrinfo_barrier( thread_pa );
+			if ( packa && !prepacka ) bli_thrinfo_barrier( thread_pa );
 		}
 	}
 
 	// Release any memory that was acquired for packing matrices A and B.
 	bli_packm_sup_finalize_mem
 	(
-	  packa,
+	  packa && !prepacka,
 	  thread_pa
 	);
 	bli_packm_sup_finalize_mem
 	(
-	  packb,
+	  packb && !prepackb,
 	  thread_pb
 	);
 
@@ -530,9 +575,28 @@ void bli_gemmsup_ref_var2m
 	const void* buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
 	const void* buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
 
+	// Operands that were packed ahead of time via bli_gemmsup_pack_a() or
+	// bli_gemmsup_pack_b() are stepped through one micropanel at a time in
+	// the m (or n) dimension, so we substitute the panel stride (in units
+	// of micropanel rows) for the row (or column) stride.
+	const bool prepacka = bli_obj_is_sup_packed( a );
+	const bool prepackb = bli_obj_is_sup_packed( b );
+
+	if ( prepacka || prepackb )
+	{
+		if ( prepacka ) { packa = TRUE; rs_a = bli_obj_panel_stride( a ) / bli_obj_panel_dim( a ); }
+		if ( prepackb ) { packb = TRUE; cs_b = bli_obj_panel_stride( b ) / bli_obj_panel_dim( b ); }
+
+		// bli_gemmsup_int() chose a millikernel that expects row-stored B,
+		// so pack B if it was not pre-packed and is not row-stored.
+		if ( !prepackb && cs_b != 1 ) packb = TRUE;
+	}
+
 #if 1
 	// Optimize some storage/packing cases by transforming them into others.
 	// These optimizations are expressed by changing trans and/or stor_id.
+	// (Pre-packed operands rule out any such transformation.)
+	if ( !prepacka && !prepackb )
 	bli_gemmsup_ref_var1n2m_opt_cases( dt, &trans, packa, packb, &stor_id, cntx );
 #endif
 
@@ -696,20 +760,33 @@ void bli_gemmsup_ref_var2m
 			// b and the _b_use strides will be set accordingly.) Then call
 			// the packm sup variant chooser, which will call the appropriate
 			// implementation based on the schema deduced from the stor_id.
-			bli_packm_sup
-			(
-			  packb,
-			  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix B to
-			  stor_id,                 // a "panel of B."
-			  dt,
-			  nc_cur, kc_cur, NR,
-			  one,
-			  b_pc,   cs_b,      rs_b,
-			  ( void** )&b_use, &cs_b_use, &rs_b_use,
-			                    &ps_b_use,
-			  cntx,
-			  thread_pb
-			);
+			if ( prepackb )
+			{
+				bli_packm_sup_prepacked
+				(
+				  NR,
+				  b_pc,   cs_b,      rs_b,
+				  ( void** )&b_use, &cs_b_use, &rs_b_use,
+				                    &ps_b_use
+				);
+			}
+			else
+			{
+				bli_packm_sup
+				(
+				  packb,
+				  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix B to
+				  stor_id,                 // a "panel of B."
+				  dt,
+				  nc_cur, kc_cur, NR,
+				  one,
+				  b_pc,   cs_b,      rs_b,
+				  ( void** )&b_use, &cs_b_use, &rs_b_use,
+				                    &ps_b_use,
+				  cntx,
+				  thread_pb
+				);
+			}
 
 			// Alias b_use so that it's clear this is our current block of
 			// matrix B.
@@ -750,20 +827,33 @@ void bli_gemmsup_ref_var2m
 				// a and the _a_use strides will be set accordingly.) Then call
 				// the packm sup variant chooser, which will call the appropriate
 				// implementation based on the schema deduced from the stor_id.
-				bli_packm_sup
-				(
-				  packa,
-				  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix A to
-				  stor_id,                 // a "block of A."
-				  dt,
-				  mc_cur, kc_cur, MR,
-				  one,
-				  a_ic,   rs_a,      cs_a,
-				  ( void** )&a_use, &rs_a_use, &cs_a_use,
-				                    &ps_a_use,
-				  cntx,
-				  thread_pa
-				);
+				if ( prepacka )
+				{
+					bli_packm_sup_prepacked
+					(
+					  MR,
+					  a_ic,   rs_a,      cs_a,
+					  ( void** )&a_use, &rs_a_use, &cs_a_use,
+					                    &ps_a_use
+					);
+				}
+				else
+				{
+					bli_packm_sup
+					(
+					  packa,
+					  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix A to
+					  stor_id,                 // a "block of A."
+					  dt,
+					  mc_cur, kc_cur, MR,
+					  one,
+					  a_ic,   rs_a,      cs_a,
+					  ( void** )&a_use, &rs_a_use, &cs_a_use,
+					                    &ps_a_use,
+					  cntx,
+					  thread_pa
+					);
+				}
 
 				// Alias a_use so that it's clear this is our current block of
 				// matrix A.
@@ -832,19 +922,19 @@ void bli_gemmsup_ref_var2m
 
 			// NOTE: This barrier is only needed if we are packing B (since
 			// that matrix is packed within the pc loop of this variant).
-			if ( packb ) bli_thrinfo_barrier( thread_pb );
+			if ( packb && !prepackb ) bli_thrinfo_barrier( thread_pb );
 		}
 	}
 
 	// Release any memory that was acquired for packing matrices A and B.
 	bli_packm_sup_finalize_mem
 	(
-	  packa,
+	  packa && !prepacka,
 	  thread_pa
 	);
 	bli_packm_sup_finalize_mem
 	(
-	  packb,
+	  packb && !prepackb,
 	  thread_pb
 	);
 
@@ -53,6 +53,8 @@ typedef void (*PASTECH(opname,_ukr_ft)) \
 GENTDEF( gemm )
 GENTDEF( gemmtrsm )
 GENTDEF( trsm )
+GENTDEF( gemm_epilogue )
+GENTDEF( i8gemm )
 
 
 #endif
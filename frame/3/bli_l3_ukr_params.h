@@ -65,6 +65,22 @@
              void*  b, \
              void*  c, inc_t rs_c, inc_t cs_c
 
+#define gemm_epilogue_params \
+\
+             dim_t  m, \
+             dim_t  n, \
+             dim_t  off_m, \
+             dim_t  off_n, \
+       const void*  epilogue, \
+             void*  c, inc_t rs_c, inc_t cs_c
+
+#define i8gemm_params \
+\
+             dim_t  k, \
+       const void*  a, \
+       const void*  b, \
+             void*  ab, inc_t rs_ab
+
 
 #endif
 
@@ -55,6 +55,19 @@ void PASTEMAC(ch,funcname) \
 #define GEMMTRSM_UKR_PROT( ctype, ch, fn )  L3TPROT( ctype, ch, fn, gemmtrsm );
 #define TRSM_UKR_PROT(     ctype, ch, fn )  L3TPROT( ctype, ch, fn, trsm );
 
+#define GEMM_EPILOGUE_UKR_PROT( ctype, ch, fn )  L3TPROT( ctype, ch, fn, gemm_epilogue );
+
+// The int8 gemm micro-kernel is not parameterized by datatype, so its
+// prototype is generated from the full function name.
+#define I8GEMM_UKR_PROT( fn ) \
+\
+void fn \
+     ( \
+       i8gemm_params, \
+       BLIS_AUXINFO_PARAM, \
+       BLIS_CNTX_PARAM  \
+     );
+
 
 #endif
 
@@ -35,3 +35,6 @@
 #include "bli_gemm_cntl.h"
 
 #include "bli_gemm_var.h"
+#include "bli_gemm_pack.h"
+#include "bli_gemm_epilogue.h"
+#include "bli_gemm_prologue.h"
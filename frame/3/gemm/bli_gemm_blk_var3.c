@@ -34,6 +34,27 @@
 
 #include "blis.h"
 
+static void bli_gemm_blk_var3_k
+     (
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     c,
+             bool       partial_k,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread
+     );
+
+static void bli_gemm_blk_var3_reduce
+     (
+       const obj_t*     c,
+             void*      c_part,
+             dim_t      k_trans,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     );
+
 void bli_gemm_blk_var3
      (
        const obj_t*     a,
@@ -51,14 +72,105 @@ void bli_gemm_blk_var3
 
 	thrinfo_t* thread = bli_thrinfo_sub_node( 0, thread_par );
 
-	// Determine the direction in which to partition (forwards or backwards).
-	const dir_t direct = bli_part_cntl_direct( cntl );
-
 	// Prune any zero region that exists along the partitioning dimension.
 	bli_l3_prune_unref_mparts_k( &ap, &bp, &cs );
 
 	// Query dimension in partitioning direction.
-	dim_t k_trans = bli_obj_width_after_trans( &ap );
+	const dim_t k_trans = bli_obj_width_after_trans( &ap );
+
+	const dim_t pc_nt = bli_thrinfo_n_way( thread );
+
+	if ( pc_nt == 1 )
+	{
+		bli_gemm_blk_var3_k( &ap, &bp, &cs, FALSE, cntx, cntl, thread );
+		return;
+	}
+
+	// Otherwise, the k dimension is partitioned among pc_nt groups of
+	// threads (which only happens for gemm; see bli_gemm_cntl_init()). Group
+	// 0 updates C directly, while every other group computes its partial
+	// product into a private copy of C. These copies are then added to C
+	// by all of the threads once every group has finished.
+	const dim_t pc_id   = bli_thrinfo_work_id( thread );
+	const dim_t m       = bli_obj_length( &cs );
+	const dim_t n       = bli_obj_width( &cs );
+	const siz_t dt_size = bli_obj_elem_size( &cs );
+
+	// Acquire the private copies of C from the pba. Since nothing packs
+	// into the thrinfo_t node of the parent, its mem_t entry is used to
+	// hold (and reuse) the block between calls.
+	char* c_part = bli_packm_alloc_ex
+	(
+	  ( pc_nt - 1 ) * m * n * dt_size,
+	  BLIS_BUFFER_FOR_GEN_USE,
+	  thread_par
+	);
+
+	// Determine the range of the k dimension assigned to this group.
+	dim_t k_start, k_end;
+	bli_thread_range_sub( pc_id, pc_nt, k_trans,
+	                      bli_part_cntl_blksz_mult( cntl ),
+	                      FALSE, &k_start, &k_end );
+
+	obj_t a1, b1, c1;
+	bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1,
+	                        k_start, k_end - k_start, &ap, &a1 );
+	bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1,
+	                        k_start, k_end - k_start, &bp, &b1 );
+	bli_obj_alias_to( &cs, &c1 );
+
+	if ( pc_id != 0 )
+	{
+		// Point c1 at this group's private copy of C, which is stored the
+		// same way as C and must be overwritten rather than updated.
+		const bool row_stored = bli_obj_is_row_tilted( &cs );
+
+		bli_obj_set_buffer( c_part + ( pc_id - 1 ) * m * n * dt_size, &c1 );
+		bli_obj_set_strides( row_stored ? n : 1,
+		                     row_stored ? 1 : m, &c1 );
+		bli_obj_set_offs( 0, 0, &c1 );
+
+		obj_t zero;
+		bli_obj_scalar_init_detached_copy_of( bli_obj_scalar_dt( &c1 ),
+		                                      BLIS_NO_CONJUGATE,
+		                                      &BLIS_ZERO,
+		                                      &zero );
+		bli_obj_scalar_attach( BLIS_NO_CONJUGATE, &zero, &c1 );
+	}
+
+	// None of the groups holds the full sum over the k dimension, so any
+	// epilogue is deferred until after the reduction.
+	bli_gemm_blk_var3_k( &a1, &b1, &c1, TRUE, cntx, cntl, thread );
+
+	// Wait for all groups to finish before reducing their partial products.
+	bli_thrinfo_barrier( thread_par );
+
+	bli_gemm_blk_var3_reduce( &cs, c_part, k_trans, cntx, cntl, thread_par );
+
+	// Wait for the reduction to finish before the private copies of C may
+	// be overwritten by the next call.
+	bli_thrinfo_barrier( thread_par );
+}
+
+static void bli_gemm_blk_var3_k
+     (
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     c,
+             bool       partial_k,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread
+     )
+{
+	obj_t cs;
+	bli_obj_alias_to( c, &cs );
+
+	// Determine the direction in which to partition (forwards or backwards).
+	const dir_t direct = bli_part_cntl_direct( cntl );
+
+	// Query dimension in partitioning direction.
+	dim_t k_trans = bli_obj_width_after_trans( a );
 
 	// Partition along the k dimension.
 	dim_t b_alg;
@@ -72,9 +184,13 @@ void bli_gemm_blk_var3
 		// Acquire partitions for A1 and B1.
 		obj_t a1, b1;
 		bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
-		                        i, b_alg, &ap, &a1 );
+		                        i, b_alg, a, &a1 );
 		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
-		                        i, b_alg, &bp, &b1 );
+		                        i, b_alg, b, &b1 );
+
+		// Mark C as holding a partial sum for all but the last iteration so
+		// that any epilogue is deferred until the final rank-k update.
+		bli_obj_set_partial_k( partial_k || i + b_alg < k_trans, &cs );
 
 		// Perform gemm subproblem.
 		bli_l3_int
@@ -113,3 +229,86 @@ void bli_gemm_blk_var3
 	}
 }
 
+static void bli_gemm_blk_var3_reduce
+     (
+       const obj_t*     c,
+             void*      c_part,
+             dim_t      k_trans,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     )
+{
+	const dim_t pc_nt      = bli_thrinfo_n_way( bli_thrinfo_sub_node( 0, thread_par ) );
+	const dim_t m          = bli_obj_length( c );
+	const dim_t n          = bli_obj_width( c );
+	const siz_t dt_size    = bli_obj_elem_size( c );
+	const bool  row_stored = bli_obj_is_row_tilted( c );
+
+	// Locate the macro-kernel node, which is the last node above the leaf
+	// of the control tree, to query the epilogue (if any).
+	const cntl_t* ker = cntl;
+	while ( !bli_cntl_is_leaf( bli_cntl_sub_node( 0, ker ) ) )
+		ker = bli_cntl_sub_node( 0, ker );
+
+	const gemm_epilogue_t* epilogue  = bli_obj_is_partial_k( c )
+	                                   ? NULL : bli_gemm_var_cntl_epilogue( ker );
+	const bool             epi_trans = bli_gemm_var_cntl_epilogue_trans( ker );
+
+	// Partition C among all of the threads along its non-contiguous
+	// dimension, so that each thread reduces (and applies the epilogue to)
+	// whole rows or columns of C.
+	dim_t start, end;
+	bli_thread_range_sub( bli_thrinfo_thread_id( thread_par ),
+	                      bli_thrinfo_num_threads( thread_par ),
+	                      row_stored ? m : n, 1, FALSE, &start, &end );
+
+	if ( start == end ) return;
+
+	obj_t c1;
+	if ( row_stored )
+		bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1,
+		                        start, end - start, c, &c1 );
+	else
+		bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1,
+		                        start, end - start, c, &c1 );
+
+	// Add the private copies of C in order of increasing group, so that the
+	// result does not depend on which group finished first.
+	for ( dim_t pc_id = 1; pc_id < pc_nt; pc_id++ )
+	{
+		// Skip any group that was not assigned part of the k dimension.
+		dim_t k_start, k_end;
+		bli_thread_range_sub( pc_id, pc_nt, k_trans,
+		                      bli_part_cntl_blksz_mult( cntl ),
+		                      FALSE, &k_start, &k_end );
+		if ( k_start == k_end ) continue;
+
+		char* c_cur = ( char* )c_part + ( pc_id - 1 ) * m * n * dt_size;
+
+		obj_t cp1;
+		bli_obj_alias_to( &c1, &cp1 );
+		bli_obj_set_buffer( c_cur + start * dt_size * ( row_stored ? n : m ), &cp1 );
+		bli_obj_set_strides( row_stored ? n : 1,
+		                     row_stored ? 1 : m, &cp1 );
+		bli_obj_set_offs( 0, 0, &cp1 );
+
+		bli_addm_ex( &cp1, &c1, cntx, NULL );
+	}
+
+	if ( epilogue )
+		bli_gemm_epilogue_apply_tile
+		(
+		  epilogue,
+		  epi_trans,
+		  bli_obj_dt( &c1 ),
+		  bli_obj_length( &c1 ),
+		  bli_obj_width( &c1 ),
+		  bli_obj_row_off( &c1 ),
+		  bli_obj_col_off( &c1 ),
+		  bli_obj_buffer_at_off( &c1 ),
+		  bli_obj_row_stride( &c1 ),
+		  bli_obj_col_stride( &c1 ),
+		  cntx
+		);
+}
@@ -39,6 +39,22 @@
 
 static packm_ker_ft GENARRAY2_MIXP(packm_struc_cxk,packm_struc_cxk);
 
+// Query the packing kernel that reads (and casts) elements of datatype dt
+// into a micro-panel of datatype dt_p. Half-precision operands are not part
+// of the table above since they are always widened to a real floating-point
+// datatype.
+static packm_ker_ft bli_gemm_cntl_packm_ker( num_t dt, num_t dt_p )
+{
+	if ( bli_is_bfloat( dt ) )
+		return bli_is_float( dt_p ) ? bli_bspackm_struc_cxk
+		                            : bli_bdpackm_struc_cxk;
+	else if ( bli_is_hfloat( dt ) )
+		return bli_is_float( dt_p ) ? bli_hspackm_struc_cxk
+		                            : bli_hdpackm_struc_cxk;
+
+	return packm_struc_cxk[ dt ][ dt_p ];
+}
+
 void bli_gemm_var_cntl_init_node
      (
        void_fp          var_func,
@@ -65,6 +81,10 @@ void bli_gemm_var_cntl_init_node
 	cntl->mr_scale = mr_scale;
 	cntl->nr_scale = nr_scale;
 
+	cntl->epilogue       = NULL;
+	cntl->epilogue_trans = FALSE;
+	cntl->jrir_dyn       = FALSE;
+
 	bli_cntl_init_node
 	(
 	  var_func,
@@ -95,7 +115,7 @@ bool bli_gemm_cntl_init
 	const prec_t comp_prec = bli_obj_comp_prec( c );
 	const num_t  dt_c      = bli_obj_dt( c );
 	const num_t  dt_comp   = ( induced ? BLIS_REAL : bli_dt_domain( dt_c ) ) | comp_prec;
-	const bool   row_pref  = bli_cntx_get_ukr_prefs_dt( dt_comp, BLIS_GEMM_UKR_ROW_PREF, cntx );
+	      bool   row_pref  = bli_cntx_get_ukr_prefs_dt( dt_comp, BLIS_GEMM_UKR_ROW_PREF, cntx );
 
 	// An optimization: If C is stored by rows and the micro-kernel prefers
 	// contiguous columns, or if C is stored by columns and the micro-kernel
@@ -104,6 +124,27 @@ bool bli_gemm_cntl_init
 	bool needs_swap = (  row_pref && bli_obj_is_col_tilted( c ) ) ||
 	                  ( !row_pref && bli_obj_is_row_tilted( c ) );
 
+	// If the context also provides a gemm micro-kernel with the opposite
+	// storage preference, use it instead of transposing the operation. This
+	// keeps the roles of A and B (and thus the packing and threading
+	// decisions made for them) as the caller specified them. Only plain gemm
+	// in a single domain is handled this way; the other operations and the
+	// induced and mixed-domain cases rely on the native micro-kernel and its
+	// block sizes.
+	const gemm_ukr_ft alt_gemm_ukr = bli_cntx_get_ukr_dt( dt_comp, BLIS_GEMM_ALT_UKR, cntx );
+	const bool        use_alt      = needs_swap &&
+	                                 alt_gemm_ukr != NULL &&
+	                                 family == BLIS_GEMM &&
+	                                 !induced &&
+	                                 !bli_obj_is_panel_packed( a ) &&
+	                                 !bli_obj_is_panel_packed( b );
+
+	if ( use_alt )
+	{
+		row_pref   = !row_pref;
+		needs_swap = FALSE;
+	}
+
 	// NOTE: This case casts right-side symm/hemm/trmm/trmm3 in terms of left side.
 	// This may be necessary when the current subconfiguration uses a gemm microkernel
 	// that assumes that the packing kernel will have already duplicated
@@ -134,6 +175,11 @@ bool bli_gemm_cntl_init
 	if ( family == BLIS_TRMM3 ) needs_swap = bli_obj_is_triangular( b );
 #endif
 
+	// Pre-packed operands cannot be swapped since they were packed as either
+	// the left- or right-hand operand.
+	if ( bli_obj_is_panel_packed( a ) || bli_obj_is_panel_packed( b ) )
+		needs_swap = FALSE;
+
 	if ( a_is_real && !b_is_real && !c_is_real )
 	{
 		// C := R * C *must* be swapped for column-preferring kernels
@@ -210,6 +256,15 @@ bool bli_gemm_cntl_init
 	gemm_ukr_ft gemm_ukr        = bli_cntx_get_ukr2_dt( dt_comp, dt_c, BLIS_GEMM_UKR, cntx );
 	gemm_ukr_ft real_gemm_ukr   = bli_cntx_get_ukr_dt( dt_comp, BLIS_GEMM_UKR, cntx );
 
+	// When the alternate micro-kernel is used, call it directly unless C
+	// must be typecast, in which case the mixed-precision wrapper calls it
+	// via the control tree instead.
+	if ( use_alt )
+	{
+		real_gemm_ukr = alt_gemm_ukr;
+		if ( dt_c == dt_comp ) gemm_ukr = alt_gemm_ukr;
+	}
+
 	// Set the macrokernel function pointer based on the operation family
 	// and struc/uplo properties.
 #ifdef BLIS_ENABLE_JRIR_TLB
@@ -245,31 +300,37 @@ bool bli_gemm_cntl_init
 #endif
 
 	const bool         trmm_r        = family == BLIS_TRMM && bli_obj_is_triangular( b );
+	const bool         pc_par        = family == BLIS_GEMM;
 	const bool         a_lo_tri      = bli_obj_is_triangular( a ) && bli_obj_is_lower( a );
 	const bool         b_up_tri      = bli_obj_is_triangular( b ) && bli_obj_is_upper( b );
 	      pack_t       schema_a      = BLIS_PACKED_PANELS;
 	      pack_t       schema_b      = BLIS_PACKED_PANELS;
-	const packm_ker_ft packm_a_ukr   = packm_struc_cxk[ dt_a ][ dt_ap ];
-	const packm_ker_ft packm_b_ukr   = packm_struc_cxk[ dt_b ][ dt_bp ];
-	const dim_t        mr_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_MR, cntx );
-	const dim_t        mr_pack       = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_MR, cntx );
-	const dim_t        mr_bcast      = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_BBM, cntx );
+	const packm_ker_ft packm_a_ukr   = bli_gemm_cntl_packm_ker( dt_a, dt_ap );
+	const packm_ker_ft packm_b_ukr   = bli_gemm_cntl_packm_ker( dt_b, dt_bp );
+	const bszid_t      mr_id         = use_alt ? BLIS_MR_ALT : BLIS_MR;
+	const bszid_t      nr_id         = use_alt ? BLIS_NR_ALT : BLIS_NR;
+	const bszid_t      mc_id         = use_alt ? BLIS_MC_ALT : BLIS_MC;
+	const bszid_t      nc_id         = use_alt ? BLIS_NC_ALT : BLIS_NC;
+	const bszid_t      kc_id         = use_alt ? BLIS_KC_ALT : BLIS_KC;
+	const dim_t        mr_def        = bli_cntx_get_blksz_def_dt( dt_comp, mr_id, cntx );
+	const dim_t        mr_pack       = bli_cntx_get_blksz_max_dt( dt_comp, mr_id, cntx );
+	const dim_t        mr_bcast      = use_alt ? 1 : bli_cntx_get_blksz_max_dt( dt_comp, BLIS_BBM, cntx );
 	      dim_t        mr_scale      = 1;
 	      dim_t        mr_pack_scale = 1;
-	const dim_t        nr_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_NR, cntx );
-	const dim_t        nr_pack       = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_NR, cntx );
-	const dim_t        nr_bcast      = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_BBN, cntx );
+	const dim_t        nr_def        = bli_cntx_get_blksz_def_dt( dt_comp, nr_id, cntx );
+	const dim_t        nr_pack       = bli_cntx_get_blksz_max_dt( dt_comp, nr_id, cntx );
+	const dim_t        nr_bcast      = use_alt ? 1 : bli_cntx_get_blksz_max_dt( dt_comp, BLIS_BBN, cntx );
 	      dim_t        nr_scale      = 1;
 	      dim_t        nr_pack_scale = 1;
 	const dim_t        kr_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_KR, cntx );
-	const dim_t        mc_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_MC, cntx );
-	const dim_t        mc_max        = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_MC, cntx );
+	const dim_t        mc_def        = bli_cntx_get_blksz_def_dt( dt_comp, mc_id, cntx );
+	const dim_t        mc_max        = bli_cntx_get_blksz_max_dt( dt_comp, mc_id, cntx );
 	      dim_t        mc_scale      = 1;
-	const dim_t        nc_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_NC, cntx );
-	const dim_t        nc_max        = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_NC, cntx );
+	const dim_t        nc_def        = bli_cntx_get_blksz_def_dt( dt_comp, nc_id, cntx );
+	const dim_t        nc_max        = bli_cntx_get_blksz_max_dt( dt_comp, nc_id, cntx );
 	      dim_t        nc_scale      = 1;
-	const dim_t        kc_def        = bli_cntx_get_blksz_def_dt( dt_comp, BLIS_KC, cntx );
-	const dim_t        kc_max        = bli_cntx_get_blksz_max_dt( dt_comp, BLIS_KC, cntx );
+	const dim_t        kc_def        = bli_cntx_get_blksz_def_dt( dt_comp, kc_id, cntx );
+	const dim_t        kc_max        = bli_cntx_get_blksz_max_dt( dt_comp, kc_id, cntx );
 	      dim_t        kc_scale      = 1;
 
 	if ( im == BLIS_1M )
@@ -471,10 +532,15 @@ bool bli_gemm_cntl_init
 	  bli_obj_is_triangular( a ) || bli_obj_is_upper_or_lower( c ),
 	  &cntl->part_ic
 	);
+	// Only gemm reduces over partial products of C when the pc loop is
+	// parallelized (see bli_gemm_blk_var3()), so for the other operations
+	// any ways of parallelism requested there are folded into the ic loop.
 	bli_cntl_attach_sub_node
 	(
-	  trmm_r ? BLIS_THREAD_MC | BLIS_THREAD_NC
-	         : BLIS_THREAD_MC,
+	  ( trmm_r ? BLIS_THREAD_MC | BLIS_THREAD_NC
+	           : BLIS_THREAD_MC ) |
+	  ( pc_par ? BLIS_THREAD_NONE
+	           : BLIS_THREAD_KC ),
 	  ( cntl_t* )&cntl->pack_a,
 	  ( cntl_t* )&cntl->part_ic
 	);
@@ -524,7 +590,8 @@ bool bli_gemm_cntl_init
 	);
 	bli_cntl_attach_sub_node
 	(
-	  BLIS_THREAD_KC,
+	  pc_par ? BLIS_THREAD_KC
+	         : BLIS_THREAD_NONE,
 	  ( cntl_t* )&cntl->pack_b,
 	  ( cntl_t* )&cntl->part_pc
 	);
@@ -51,6 +51,16 @@ struct gemm_var_cntl_s
 	dim_t       mr_scale;
 	dim_t       nr_scale;
 	bool        row_pref;
+
+	// An optional epilogue applied to each microtile of C once it holds the
+	// final result, and whether the operation was transposed relative to
+	// the C for which the epilogue was specified.
+	const gemm_epilogue_t* epilogue;
+	bool        epilogue_trans;
+
+	// Whether the threads sharing the jr and ir loops claim microtiles from
+	// a shared counter instead of partitioning them statically.
+	bool        jrir_dyn;
 };
 typedef struct gemm_var_cntl_s gemm_var_cntl_t;
 
@@ -96,6 +106,21 @@ BLIS_INLINE num_t bli_gemm_var_cntl_comp_dt( const cntl_t* cntl )
 	return ( ( const gemm_var_cntl_t* ) cntl )->dt_comp;
 }
 
+BLIS_INLINE const gemm_epilogue_t* bli_gemm_var_cntl_epilogue( const cntl_t* cntl )
+{
+	return ( ( const gemm_var_cntl_t* ) cntl )->epilogue;
+}
+
+BLIS_INLINE bool bli_gemm_var_cntl_epilogue_trans( const cntl_t* cntl )
+{
+	return ( ( const gemm_var_cntl_t* ) cntl )->epilogue_trans;
+}
+
+BLIS_INLINE bool bli_gemm_var_cntl_jrir_dyn( const cntl_t* cntl )
+{
+	return ( ( const gemm_var_cntl_t* ) cntl )->jrir_dyn;
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE void bli_gemm_var_cntl_set_ukr( const func2_t* ukr, cntl_t* cntl_ )
@@ -168,6 +193,17 @@ BLIS_INLINE void bli_gemm_var_cntl_set_comp_dt( num_t dt, const cntl_t* cntl )
 	( ( gemm_var_cntl_t* ) cntl )->dt_comp = dt;
 }
 
+BLIS_INLINE void bli_gemm_var_cntl_set_epilogue( const gemm_epilogue_t* epilogue, bool trans, cntl_t* cntl )
+{
+	( ( gemm_var_cntl_t* ) cntl )->epilogue       = epilogue;
+	( ( gemm_var_cntl_t* ) cntl )->epilogue_trans = trans;
+}
+
+BLIS_INLINE void bli_gemm_var_cntl_set_jrir_dyn( bool jrir_dyn, cntl_t* cntl )
+{
+	( ( gemm_var_cntl_t* ) cntl )->jrir_dyn = jrir_dyn;
+}
+
 // -----------------------------------------------------------------------------
 
 void bli_gemm_var_cntl_init_node
@@ -381,6 +417,28 @@ BLIS_INLINE void bli_gemm_cntl_set_params( const void* params, gemm_cntl_t* cntl
 	}
 }
 
+BLIS_INLINE void bli_gemm_cntl_set_epilogue( const gemm_epilogue_t* epilogue, bool trans, gemm_cntl_t* cntl )
+{
+	bli_gemm_var_cntl_set_epilogue( epilogue, trans, ( cntl_t* )&cntl->ker );
+}
+
+BLIS_INLINE void bli_gemm_cntl_set_jrir_dyn( bool jrir_dyn, gemm_cntl_t* cntl )
+{
+	bli_gemm_var_cntl_set_jrir_dyn( jrir_dyn, ( cntl_t* )&cntl->ker );
+}
+
+BLIS_INLINE void bli_gemm_cntl_set_prologue( const gemm_prologue_t* prologue, bool trans, gemm_cntl_t* cntl )
+{
+	// B is always packed as B^T, so its prologue sees the transpose of the
+	// packed micropanels. If the operation was transposed, A and B (and
+	// thus their prologues) trade places.
+	cntl_t* pack_a = trans ? ( cntl_t* )&cntl->pack_b : ( cntl_t* )&cntl->pack_a;
+	cntl_t* pack_b = trans ? ( cntl_t* )&cntl->pack_a : ( cntl_t* )&cntl->pack_b;
+
+	bli_packm_def_cntl_set_prologue( prologue->func_a, prologue->params_a, FALSE, pack_a );
+	bli_packm_def_cntl_set_prologue( prologue->func_b, prologue->params_b, TRUE,  pack_b );
+}
+
 BLIS_INLINE void bli_gemm_cntl_set_var( l3_var_oft var, gemm_cntl_t* cntl )
 {
 	bli_cntl_set_var_func( ( void_fp )var, ( cntl_t* )&cntl->ker );
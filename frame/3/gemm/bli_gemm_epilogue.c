@@ -0,0 +1,176 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_gemm_epilogue_init
+     (
+       gemm_epilogue_t* epilogue
+     )
+{
+	epilogue->scale      = NULL;
+	epilogue->scale_side = BLIS_LEFT;
+	epilogue->bias       = NULL;
+	epilogue->bias_side  = BLIS_LEFT;
+	epilogue->act        = BLIS_ACT_NONE;
+	epilogue->act_lo     = 0.0;
+	epilogue->act_hi     = 0.0;
+	epilogue->func       = NULL;
+	epilogue->params     = NULL;
+}
+
+static void bli_gemm_epilogue_check_vector
+     (
+       const obj_t* x,
+             side_t side,
+       const obj_t* c
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_valid_side( side );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( x, c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( x, bli_is_left( side )
+	                                        ? bli_obj_length_after_trans( c )
+	                                        : bli_obj_width_after_trans( c ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+}
+
+void bli_gemm_epilogue_check
+     (
+       const gemm_epilogue_t* epilogue,
+       const obj_t*           c
+     )
+{
+	err_t e_val;
+
+	// The epilogue is applied in the storage datatype of C.
+	e_val = bli_check_floating_object( c );
+	bli_check_error_code( e_val );
+
+	if ( epilogue->scale )
+		bli_gemm_epilogue_check_vector( epilogue->scale, epilogue->scale_side, c );
+
+	if ( epilogue->bias )
+		bli_gemm_epilogue_check_vector( epilogue->bias, epilogue->bias_side, c );
+
+	if ( epilogue->act < BLIS_ACT_NONE || BLIS_NUM_ACT_TYPES <= epilogue->act )
+		bli_check_error_code( BLIS_INVALID_ACTIVATION );
+
+	// Activation functions are only defined for real datatypes.
+	if ( epilogue->act != BLIS_ACT_NONE )
+	{
+		e_val = bli_check_real_object( c );
+		bli_check_error_code( e_val );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_epilogue_apply_tile
+     (
+       const gemm_epilogue_t* epilogue,
+             bool             trans,
+             num_t            dt,
+             dim_t            m,
+             dim_t            n,
+             dim_t            off_m,
+             dim_t            off_n,
+             void*            c, inc_t rs_c, inc_t cs_c,
+       const cntx_t*          cntx
+     )
+{
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	// Express the microtile in terms of the C for which the epilogue was
+	// specified.
+	if ( trans )
+	{
+		bli_swap_dims( &m, &n );
+		bli_swap_dims( &off_m, &off_n );
+		bli_swap_incs( &rs_c, &cs_c );
+	}
+
+	if ( epilogue->scale || epilogue->bias || epilogue->act != BLIS_ACT_NONE )
+	{
+		gemm_epilogue_ukr_ft f = ( gemm_epilogue_ukr_ft )bli_cntx_get_ukr_dt( dt, BLIS_GEMM_EPILOGUE_UKR, cntx );
+
+		f( m, n, off_m, off_n, epilogue, c, rs_c, cs_c, NULL, cntx );
+	}
+
+	if ( epilogue->func )
+		epilogue->func( dt, m, n, off_m, off_n, c, rs_c, cs_c, epilogue->params );
+}
+
+void bli_gemm_epilogue_apply
+     (
+       const gemm_epilogue_t* epilogue,
+       const obj_t*           c,
+       const cntx_t*          cntx
+     )
+{
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Resolve any transposition of C so that the epilogue sees the matrix
+	// in the same orientation as the fused path does.
+	obj_t c_local;
+	bli_obj_alias_submatrix( c, &c_local );
+
+	bli_gemm_epilogue_apply_tile
+	(
+	  epilogue,
+	  FALSE,
+	  bli_obj_dt( &c_local ),
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  0,
+	  0,
+	  bli_obj_buffer_at_off( &c_local ),
+	  bli_obj_row_stride( &c_local ),
+	  bli_obj_col_stride( &c_local ),
+	  cntx
+	);
+}
+
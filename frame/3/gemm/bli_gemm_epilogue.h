@@ -0,0 +1,74 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototype object-based interfaces for fused gemm epilogues.
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_epilogue_init
+     (
+       gemm_epilogue_t* epilogue
+     );
+
+void bli_gemm_epilogue_check
+     (
+       const gemm_epilogue_t* epilogue,
+       const obj_t*           c
+     );
+
+// Apply an epilogue to all of C as a separate pass (for code paths that do
+// not fuse it into the macro-kernel).
+void bli_gemm_epilogue_apply
+     (
+       const gemm_epilogue_t* epilogue,
+       const obj_t*           c,
+       const cntx_t*          cntx
+     );
+
+// Apply an epilogue to the m x n microtile of C whose top-left element lies
+// at (off_m,off_n). If trans is TRUE, the microtile (and its offsets) refer
+// to the transpose of the C for which the epilogue was specified.
+void bli_gemm_epilogue_apply_tile
+     (
+       const gemm_epilogue_t* epilogue,
+             bool             trans,
+             num_t            dt,
+             dim_t            m,
+             dim_t            n,
+             dim_t            off_m,
+             dim_t            off_n,
+             void*            c, inc_t rs_c, inc_t cs_c,
+       const cntx_t*          cntx
+     );
+
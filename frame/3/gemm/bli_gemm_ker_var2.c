@@ -106,6 +106,12 @@ void bli_gemm_ker_var2
 	gemm_ukr_ft gemm_ukr = bli_gemm_var_cntl_ukr( cntl );
 	const void* params   = bli_gemm_var_cntl_params( cntl );
 
+	// Query the epilogue, if any. It may only be applied once C holds the
+	// full sum over the k dimension.
+	const gemm_epilogue_t* epilogue = bli_obj_is_partial_k( c )
+	                                  ? NULL : bli_gemm_var_cntl_epilogue( cntl );
+	const bool             epi_trans = bli_gemm_var_cntl_epilogue_trans( cntl );
+
 	//
 	// Assumptions/assertions:
 	//   rs_a == 1
@@ -152,6 +158,38 @@ void bli_gemm_ker_var2
 
 	dim_t jr_start, jr_end, jr_inc;
 	dim_t ir_start, ir_end, ir_inc;
+	dim_t ir_tid, ir_nt, ir_next;
+	dim_t n_ut_for_me;
+
+	// Determine whether the threads executing this macro-kernel should claim
+	// their microtiles dynamically. This is only worthwhile (and only safe,
+	// since single-threaded groups may share one communicator) when there
+	// is more than one thread.
+	const dim_t      dyn_nt   = bli_thrinfo_num_threads( thread_par );
+	const bool       jrir_dyn = bli_gemm_var_cntl_jrir_dyn( cntl ) && 1 < dyn_nt;
+	      thrcomm_t* dyn_comm = bli_thrinfo_comm( thread_par );
+
+	// The total number of microtiles, and the number claimed at a time in
+	// the dynamic case.
+	const dim_t n_ut       = m_iter * n_iter;
+	const dim_t n_ut_chunk = bli_max( n_ut / ( dyn_nt * BLIS_THREAD_DYN_CHUNKS ), 1 );
+
+	if ( jrir_dyn )
+	{
+		// Each thread iterates over consecutive microtiles, going down each
+		// column of microtiles in turn, starting wherever its current chunk
+		// begins (see below).
+		jr_start = 0; jr_end = n_iter; jr_inc = 1;
+		ir_start = 0; ir_end = m_iter; ir_inc = 1;
+
+		ir_tid  = 0;
+		ir_nt   = 1;
+		ir_next = 0;
+
+		n_ut_for_me = 0;
+	}
+	else
+	{
 
 #ifdef BLIS_ENABLE_JRIR_TLB
 
@@ -161,10 +199,10 @@ void bli_gemm_ker_var2
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
 
-	const dim_t ir_nt  = 1;
-	const dim_t ir_tid = 0;
+	ir_nt  = 1;
+	ir_tid = 0;
 
-	dim_t n_ut_for_me
+	n_ut_for_me
 	=
 	bli_thread_range_tlb_d( jr_nt, jr_tid, m_iter, n_iter, MR, NR,
 	                        &jr_start, &ir_start );
@@ -179,7 +217,7 @@ void bli_gemm_ker_var2
 	ir_end = m_iter;
 
 	// Successive iterations of the ir loop should start at 0.
-	const dim_t ir_next = 0;
+	ir_next = 0;
 
 #else // ifdef ( _SLAB || _RR )
 
@@ -189,8 +227,8 @@ void bli_gemm_ker_var2
 	thrinfo_t* caucus = bli_thrinfo_sub_node( 0, thread );
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
-	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
-	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+	ir_nt  = bli_thrinfo_n_way( caucus );
+	ir_tid = bli_thrinfo_work_id( caucus );
 
 	// Determine the thread range and increment for the 2nd and 1st loops.
 	// NOTE: The definition of bli_thread_range_slrr() will depend on whether
@@ -199,11 +237,11 @@ void bli_gemm_ker_var2
 	bli_thread_range_slrr( ir_tid, ir_nt, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc );
 
 	// Calculate the total number of microtiles assigned to this thread.
-	dim_t n_ut_for_me = ( ( ir_end + ir_inc - 1 - ir_start ) / ir_inc ) *
-	                    ( ( jr_end + jr_inc - 1 - jr_start ) / jr_inc );
+	n_ut_for_me = ( ( ir_end + ir_inc - 1 - ir_start ) / ir_inc ) *
+	              ( ( jr_end + jr_inc - 1 - jr_start ) / jr_inc );
 
 	// Each succesive iteration of the ir loop always starts at ir_start.
-	const dim_t ir_next = ir_start;
+	ir_next = ir_start;
 
 #endif
 
@@ -212,6 +250,28 @@ void bli_gemm_ker_var2
 	// threads can return early.
 	if ( n_ut_for_me == 0 ) return;
 
+	}
+
+	while ( TRUE )
+	{
+	// In the dynamic case, claim the next chunk of microtiles. Once they have
+	// all been claimed, wait for the other threads so that the shared counter
+	// can safely be reused by the next call.
+	if ( jrir_dyn )
+	{
+		const dim_t ut = bli_thrcomm_claim( n_ut_chunk, n_ut, dyn_comm );
+
+		if ( n_ut <= ut )
+		{
+			bli_thrinfo_barrier( thread_par );
+			return;
+		}
+
+		jr_start    = ut / m_iter;
+		ir_start    = ut % m_iter;
+		n_ut_for_me = bli_min( n_ut_chunk, n_ut - ut );
+	}
+
 	// Loop over the n dimension (NR columns at a time).
 	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 	{
@@ -250,8 +310,8 @@ void bli_gemm_ker_var2
 
 			// Set the current offset into the C matrix in the auxinfo_t
 			// object.
-			bli_auxinfo_set_off_m( off_m + i, &aux );
-			bli_auxinfo_set_off_m( off_n + j, &aux );
+			bli_auxinfo_set_off_m( off_m + i * MR, &aux );
+			bli_auxinfo_set_off_n( off_n + j * NR, &aux );
 
 			// Edge case handling now occurs within the microkernel itself.
 			// Invoke the gemm micro-kernel.
@@ -269,13 +329,33 @@ void bli_gemm_ker_var2
 			  ( cntx_t* )cntx
 			);
 
+			// Apply the epilogue while the microtile is still in cache.
+			if ( epilogue )
+				bli_gemm_epilogue_apply_tile
+				(
+				  epilogue,
+				  epi_trans,
+				  dt_c,
+				  m_cur,
+				  n_cur,
+				  off_m + i * MR,
+				  off_n + j * NR,
+				  c11, rs_c, cs_c,
+				  cntx
+				);
+
 			// Decrement the number of microtiles assigned to the thread; once
-			// it reaches zero, return immediately.
-			n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) return;
+			// it reaches zero, stop.
+			n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) break;
 		}
 
+		if ( n_ut_for_me == 0 ) break;
+
 		ir_start = ir_next;
 	}
+
+	if ( !jrir_dyn ) return;
+	}
 }
 
 //PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var2: b1", k, NR, b1, NR, 1, "%4.1f", "" );
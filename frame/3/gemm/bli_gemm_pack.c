@@ -0,0 +1,237 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static void bli_gemm_pack_int
+     (
+             side_t  side,
+       const obj_t*  x,
+             obj_t*  xp,
+       const cntx_t* cntx
+     )
+{
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_floating_object( x );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_matrix_object( x );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( x );
+		bli_check_error_code( e_val );
+	}
+
+	// Build the control tree that bli_gemm_ex() would use for a problem
+	// whose operands all share the datatype of x. The operands below only
+	// serve to select the datatype and pack schemas; in particular, C is
+	// given the storage that the microkernel prefers so that the operation
+	// is not transposed (which would exchange the roles of A and B).
+	num_t dt       = bli_obj_dt( x );
+	bool  row_pref = bli_cntx_get_ukr_prefs_dt( dt, BLIS_GEMM_UKR_ROW_PREF, cntx );
+
+	obj_t a, b, c;
+	bli_obj_create_without_buffer( dt, 2, 2, &a );
+	bli_obj_create_without_buffer( dt, 2, 2, &b );
+	bli_obj_create_without_buffer( dt, 2, 2, &c );
+	bli_obj_set_strides( row_pref ? 2 : 1, row_pref ? 1 : 2, &c );
+
+	gemm_cntl_t cntl;
+	bli_gemm_cntl_init
+	(
+	  BLIS_NAT,
+	  BLIS_GEMM,
+	  &BLIS_ONE,
+	  &a,
+	  &b,
+	  &BLIS_ZERO,
+	  &c,
+	  cntx,
+	  &cntl
+	);
+
+	const cntl_t* node = side == BLIS_LEFT ? ( cntl_t* )&cntl.pack_a
+	                                       : ( cntl_t* )&cntl.pack_b;
+
+	// Mirror bli_l3_packa() and bli_l3_packb(): A is packed as-is, while B
+	// is packed via its transpose.
+	obj_t x_local;
+	bli_obj_alias_to( x, &x_local );
+	if ( side == BLIS_LEFT )
+	{
+		if ( bli_obj_has_trans( x ) )
+		{
+			bli_obj_induce_trans( &x_local );
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &x_local );
+		}
+	}
+	else
+	{
+		if ( bli_obj_has_trans( x ) )
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &x_local );
+		else
+			bli_obj_induce_trans( &x_local );
+	}
+
+	// Query the size of the packed matrix. Since the entire k dimension is
+	// packed at once, each micropanel spans the full k dimension of x, which
+	// allows the packed matrix to be used with any KC blocksize.
+	siz_t size_p = bli_packm_init( bli_packm_def_cntl_target_dt( node ),
+	                               &x_local, xp, node );
+
+	err_t r_val;
+	void* buf_p  = size_p != 0 ? bli_malloc_user( size_p, &r_val ) : NULL;
+
+	// Create a single-threaded thrinfo_t node and give it the buffer we
+	// just allocated, so that bli_packm_blk_var1() packs into that buffer
+	// instead of acquiring a block from the pba.
+	thrinfo_t* thread = bli_thrinfo_create_root( &BLIS_SINGLE_COMM, 0, NULL, NULL );
+	mem_t*     mem_p  = bli_thrinfo_mem( thread );
+
+	bli_mem_set_buffer( buf_p, mem_p );
+	bli_mem_set_size( size_p, mem_p );
+	bli_mem_set_buf_type( bli_packm_def_cntl_pack_buf_type( node ), mem_p );
+	bli_mem_set_pool( NULL, mem_p );
+
+	bli_packm_blk_var1( &x_local, xp, cntx, node, thread );
+
+	// Detach the buffer so that bli_thrinfo_free() does not try to return
+	// it to the pba.
+	bli_mem_clear( mem_p );
+	bli_thrinfo_free( thread );
+
+	// Make sure that xp never refers to the buffer of x (as it would if
+	// bli_packm_init() found nothing to pack), since xp owns its buffer.
+	bli_obj_set_buffer( buf_p, xp );
+
+	// Transpose the packed copy of B^T back to B.
+	if ( side == BLIS_RIGHT )
+		bli_obj_induce_trans( xp );
+
+	bli_obj_set_as_root( xp );
+}
+
+void bli_gemm_pack_a
+     (
+       const obj_t*  a,
+             obj_t*  ap,
+       const cntx_t* cntx
+     )
+{
+	bli_gemm_pack_int( BLIS_LEFT, a, ap, cntx );
+}
+
+void bli_gemm_pack_b
+     (
+       const obj_t*  b,
+             obj_t*  bp,
+       const cntx_t* cntx
+     )
+{
+	bli_gemm_pack_int( BLIS_RIGHT, b, bp, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gemm_prepacked_init_operand
+     (
+       obj_t*  x,
+       cntl_t* cntl
+     )
+{
+	// A pre-packed matrix must be used in its entirety and exactly as it was
+	// packed.
+	if ( bli_obj_conj_status( x ) != BLIS_NO_CONJUGATE ||
+	     bli_obj_row_off( x ) != 0 ||
+	     bli_obj_col_off( x ) != 0 )
+		bli_check_error_code( BLIS_INVALID_PACKED_OBJECT_VIEW );
+
+	// The pack schema, datatype, and register blocksizes were recorded in
+	// the object when it was packed. They must agree with those that the
+	// current operation would have used to pack the matrix.
+	if ( bli_obj_dt( x )                    != bli_packm_def_cntl_target_dt( cntl ) ||
+	     bli_obj_pack_schema( x )           != bli_packm_def_cntl_pack_schema( cntl ) ||
+	     bli_obj_panel_dim( x )             != bli_packm_def_cntl_bmult_m_def( cntl ) ||
+	     bli_obj_col_stride( x )            != bli_packm_def_cntl_bmult_m_pack( cntl ) ||
+	     bli_obj_row_stride( x )            != bli_packm_def_cntl_bmult_m_bcast( cntl ) ||
+	     bli_obj_padded_width( x ) % bli_packm_def_cntl_bmult_n_def( cntl ) != 0 )
+		bli_check_error_code( BLIS_PACKED_OBJECT_BLKSZ_MISMATCH );
+
+	// A transposed view of the pre-packed matrix would have been caught by
+	// the stride checks above unless the micropanel is one element wide, so
+	// also check that the k dimension is the one that was packed.
+	if ( bli_obj_width( x ) != bli_obj_panel_width( x ) )
+		bli_check_error_code( BLIS_INVALID_PACKED_OBJECT_VIEW );
+
+	// Clear the pack schema so that the matrix is partitioned like any other
+	// matrix, and substitute the packm variant that aliases the appropriate
+	// micropanels of the pre-packed matrix instead of packing.
+	bli_obj_set_pack_schema( BLIS_NOT_PACKED, x );
+	bli_packm_cntl_set_variant( bli_packm_prepacked_var1, cntl );
+}
+
+void bli_gemm_prepacked_init
+     (
+       obj_t*       a,
+       obj_t*       b,
+       gemm_cntl_t* cntl
+     )
+{
+	if ( bli_obj_is_panel_packed( a ) )
+	{
+		bli_gemm_prepacked_init_operand( a, ( cntl_t* )&cntl->pack_a );
+	}
+
+	if ( bli_obj_is_panel_packed( b ) )
+	{
+		// The pre-packed matrix stores micropanels of B^T, which is also the
+		// object seen by the packm node for B.
+		obj_t bt;
+		bli_obj_alias_to( b, &bt );
+		bli_obj_induce_trans( &bt );
+
+		bli_gemm_prepacked_init_operand( &bt, ( cntl_t* )&cntl->pack_b );
+
+		bli_obj_set_pack_schema( BLIS_NOT_PACKED, b );
+	}
+}
+
@@ -0,0 +1,77 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_gemm_prologue_init
+     (
+       gemm_prologue_t* prologue
+     )
+{
+	prologue->func_a   = NULL;
+	prologue->params_a = NULL;
+	prologue->func_b   = NULL;
+	prologue->params_b = NULL;
+}
+
+void bli_gemm_prologue_check
+     (
+       const gemm_prologue_t* prologue,
+       const obj_t*           a,
+       const obj_t*           b,
+       const obj_t*           c
+     )
+{
+	if ( prologue->func_a == NULL && prologue->func_b == NULL )
+		return;
+
+	// The prologue is applied to micropanels packed in the native format,
+	// which rules out the packing schemas used when the domains of the
+	// operands differ.
+	if ( bli_obj_domain( a ) != bli_obj_domain( c ) ||
+	     bli_obj_domain( b ) != bli_obj_domain( c ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// An operand that was packed ahead of time is not packed again, so
+	// there would be no opportunity to apply the prologue to it.
+	if ( prologue->func_a &&
+	     ( bli_obj_is_panel_packed( a ) || bli_obj_is_sup_packed( a ) ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	if ( prologue->func_b &&
+	     ( bli_obj_is_panel_packed( b ) || bli_obj_is_sup_packed( b ) ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+}
+
@@ -0,0 +1,417 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// -- int8 gemm thread decorator -----------------------------------------------
+//
+
+struct i8gemm_decor_params_s
+{
+	      bool              c_is_float;
+	      dim_t             m;
+	      dim_t             n;
+	      dim_t             k;
+	const void*             alpha;
+	const int8_t*           a; inc_t rs_a; inc_t cs_a;
+	const int8_t*           b; inc_t rs_b; inc_t cs_b;
+	const void*             beta;
+	      void*             c; inc_t rs_c; inc_t cs_c;
+	const i8gemm_qparams_t* qparams;
+	const cntx_t*           cntx;
+	      rntm_t*           rntm;
+	      array_t*          array;
+};
+typedef struct i8gemm_decor_params_s i8gemm_decor_params_t;
+
+static void bli_i8gemm_thread_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	const i8gemm_decor_params_t* data = data_void;
+
+	bli_l3_thread_decorator_thread_check( gl_comm, data->rntm );
+
+	// Create the root node of the thread's thrinfo_t structure.
+	pool_t*    pool   = bli_sba_array_elem( tid, data->array );
+	thrinfo_t* thread = bli_l3_sup_thrinfo_create( tid, gl_comm, pool, data->rntm );
+
+	bli_i8gemm_bp_var1
+	(
+	  data->c_is_float,
+	  data->m,
+	  data->n,
+	  data->k,
+	  data->alpha,
+	  data->a, data->rs_a, data->cs_a,
+	  data->b, data->rs_b, data->cs_b,
+	  data->beta,
+	  data->c, data->rs_c, data->cs_c,
+	  data->qparams,
+	  data->cntx,
+	  thread
+	);
+
+	// Free the current thread's thrinfo_t structure. The barrier prevents
+	// the packing buffers from being released while peers still use them.
+	bli_thrinfo_barrier( thread );
+	bli_thrinfo_free( thread );
+}
+
+static void bli_i8gemm_thread_decorator
+     (
+       i8gemm_decor_params_t* params
+     )
+{
+	rntm_t* rntm = params->rntm;
+
+	// Query the threading implementation and the number of threads requested.
+	timpl_t ti = bli_rntm_thread_impl( rntm );
+	dim_t   nt = bli_rntm_num_threads( rntm );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( rntm );
+
+#ifdef BLIS_ENABLE_NT1_VIA_SINGLE
+	if ( nt == 1 )
+	{
+		ti = BLIS_SINGLE;
+		bli_rntm_set_thread_impl( BLIS_SINGLE, rntm );
+	}
+#endif
+
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		// Favor the requested threading implementation over the number of
+		// threads, as the level-3 thread decorators do.
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, rntm );
+		bli_rntm_set_num_threads_only( 1, rntm );
+	}
+
+	// The pc loop of the int8 block-panel algorithm is not parallelized, so
+	// fold any parallelism requested there into the ic loop.
+	if ( bli_rntm_pc_ways( rntm ) > 1 )
+	{
+		bli_rntm_set_ways_only
+		(
+		  bli_rntm_jc_ways( rntm ),
+		  1,
+		  bli_rntm_ic_ways( rntm ) * bli_rntm_pc_ways( rntm ),
+		  bli_rntm_jr_ways( rntm ),
+		  bli_rntm_ir_ways( rntm ),
+		  rntm
+		);
+	}
+
+	// Check out an array_t from the small block allocator.
+	params->array = bli_sba_checkout_array( nt );
+
+	bli_thread_launch( ti, nt, bli_i8gemm_thread_entry, params );
+
+	bli_sba_checkin_array( params->array );
+}
+
+//
+// -- int8 gemm front-end ------------------------------------------------------
+//
+
+static void bli_i8gemm_check
+     (
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       inc_t   rs_a, inc_t cs_a,
+       inc_t   rs_b, inc_t cs_b,
+       inc_t   rs_c, inc_t cs_c
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_valid_trans( transa );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_valid_trans( transb );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( bli_does_trans( transa ) ? k : m,
+	                                  bli_does_trans( transa ) ? m : k,
+	                                  rs_a, cs_a, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( bli_does_trans( transb ) ? n : k,
+	                                  bli_does_trans( transb ) ? k : n,
+	                                  rs_b, cs_b, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m, n, rs_c, cs_c, 1 );
+	bli_check_error_code( e_val );
+}
+
+static void bli_i8gemm_front
+     (
+             bool              c_is_float,
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const void*             alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const void*             beta,
+             void*             c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     )
+{
+	bli_init_once();
+
+	if ( bli_error_checking_is_enabled() )
+		bli_i8gemm_check( transa, transb, m, n, k,
+		                  rs_a, cs_a, rs_b, cs_b, rs_c, cs_c );
+
+	// If C has a zero dimension, return early.
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	// Absorb any transpositions into the strides of A and B. Conjugation
+	// has no effect on integer data.
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	// If alpha is zero, or if k is zero, scale C by beta and return early.
+	const bool alpha_is_zero = ( c_is_float ? *( const float*   )alpha == 0.0f
+	                                        : *( const int32_t* )alpha == 0 );
+	if ( k == 0 || alpha_is_zero )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			if ( c_is_float )
+			{
+				const float  beta_l = *( const float* )beta;
+				      float* c_ij   = ( float* )c + i*rs_c + j*cs_c;
+
+				*c_ij = ( beta_l == 0.0f ? 0.0f : beta_l * *c_ij );
+			}
+			else
+			{
+				const int32_t  beta_l = *( const int32_t* )beta;
+				      int32_t* c_ij   = ( int32_t* )c + i*rs_c + j*cs_c;
+
+				*c_ij = ( int32_t )( ( uint32_t )beta_l * ( uint32_t )*c_ij );
+			}
+		}
+		return;
+	}
+
+	// Use zero points of zero and unit scales if none were given.
+	i8gemm_qparams_t qparams_l;
+	if ( qparams == NULL ) { bli_i8gemm_qparams_init( &qparams_l ); }
+	else                   { qparams_l = *qparams;                   }
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	// Both A and B are always packed. See bls_gemm_ex() for why this must be
+	// recorded in the rntm_t before the thrinfo_t tree is created.
+	bli_rntm_set_pack_a( TRUE, &rntm_l );
+	bli_rntm_set_pack_b( TRUE, &rntm_l );
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Cap the number of threads for small problems, then parse and interpret
+	// the contents of the rntm_t object to properly set the ways of
+	// parallelism for each loop.
+	bli_rntm_limit_num_threads
+	(
+	  m, n, k,
+	  bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_MR_I8, cntx ),
+	  bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_NR_I8, cntx ),
+	  &rntm_l
+	);
+	bli_rntm_factorize( m, n, k, &rntm_l );
+
+	i8gemm_decor_params_t params;
+	params.c_is_float = c_is_float;
+	params.m          = m;
+	params.n          = n;
+	params.k          = k;
+	params.alpha      = alpha;
+	params.a          = a; params.rs_a = rs_a; params.cs_a = cs_a;
+	params.b          = b; params.rs_b = rs_b; params.cs_b = cs_b;
+	params.beta       = beta;
+	params.c          = c; params.rs_c = rs_c; params.cs_c = cs_c;
+	params.qparams    = &qparams_l;
+	params.cntx       = cntx;
+	params.rntm       = &rntm_l;
+	params.array      = NULL;
+
+	bli_i8gemm_thread_decorator( &params );
+}
+
+//
+// -- Define the int8 gemm interfaces ------------------------------------------
+//
+
+void bli_i8gemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const int32_t*          alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const int32_t*          beta,
+             int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     )
+{
+	bli_i8gemm_front
+	(
+	  FALSE,
+	  transa, transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  qparams,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_i8gemm
+     (
+             trans_t  transa,
+             trans_t  transb,
+             dim_t    m,
+             dim_t    n,
+             dim_t    k,
+       const int32_t* alpha,
+       const int8_t*  a, inc_t rs_a, inc_t cs_a,
+       const int8_t*  b, inc_t rs_b, inc_t cs_b,
+       const int32_t* beta,
+             int32_t* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	bli_i8gemm_ex
+	(
+	  transa, transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  NULL,
+	  NULL,
+	  NULL
+	);
+}
+
+void bli_i8sgemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const float*            alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const float*            beta,
+             float*            c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     )
+{
+	bli_i8gemm_front
+	(
+	  TRUE,
+	  transa, transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  qparams,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_i8sgemm
+     (
+             trans_t  transa,
+             trans_t  transb,
+             dim_t    m,
+             dim_t    n,
+             dim_t    k,
+       const float*   alpha,
+       const int8_t*  a, inc_t rs_a, inc_t cs_a,
+       const int8_t*  b, inc_t rs_b, inc_t cs_b,
+       const float*   beta,
+             float*   c, inc_t rs_c, inc_t cs_c
+     )
+{
+	bli_i8sgemm_ex
+	(
+	  transa, transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  NULL,
+	  NULL,
+	  NULL
+	);
+}
+
@@ -0,0 +1,148 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// -- int8 gemm quantization parameters ----------------------------------------
+//
+
+// Zero points and requantization scales for the int8 gemm operations. Each
+// is given as a vector and an increment: the zero point of row i of op(A) is
+// za[ i*incza ] and that of column j of op(B) is zb[ j*inczb ], and likewise
+// for the scales sa and sb. An increment of zero applies the first element
+// to every row (or column), and a NULL vector stands for zero points of zero
+// (or scales of one).
+
+typedef struct i8gemm_qparams_s
+{
+	const int32_t* za; inc_t incza;
+	const int32_t* zb; inc_t inczb;
+
+	const float*   sa; inc_t incsa;
+	const float*   sb; inc_t incsb;
+} i8gemm_qparams_t;
+
+BLIS_INLINE void bli_i8gemm_qparams_init( i8gemm_qparams_t* qparams )
+{
+	qparams->za = NULL; qparams->incza = 0;
+	qparams->zb = NULL; qparams->inczb = 0;
+	qparams->sa = NULL; qparams->incsa = 0;
+	qparams->sb = NULL; qparams->incsb = 0;
+}
+
+#include "bli_i8gemm_var.h"
+
+
+//
+// -- Prototype int8 gemm interfaces -------------------------------------------
+//
+
+// bli_i8gemm_ex() computes
+//
+//   C := beta * C + alpha * ( op(A) - Za ) * ( op(B) - Zb )
+//
+// where A and B hold int8 values, C and the scalars are int32, and Za and
+// Zb are the per-row and per-column zero points of op(A) and op(B). The
+// products are accumulated exactly in int32. Scales in qparams are ignored.
+
+BLIS_EXPORT_BLIS void bli_i8gemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const int32_t*          alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const int32_t*          beta,
+             int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_i8gemm
+     (
+             trans_t  transa,
+             trans_t  transb,
+             dim_t    m,
+             dim_t    n,
+             dim_t    k,
+       const int32_t* alpha,
+       const int8_t*  a, inc_t rs_a, inc_t cs_a,
+       const int8_t*  b, inc_t rs_b, inc_t cs_b,
+       const int32_t* beta,
+             int32_t* c, inc_t rs_c, inc_t cs_c
+     );
+
+// bli_i8sgemm_ex() computes
+//
+//   C := beta * C + alpha * Sa * ( op(A) - Za ) * ( op(B) - Zb ) * Sb
+//
+// where C and the scalars are float and Sa and Sb are diagonal matrices
+// holding the per-row and per-column scales of op(A) and op(B). This
+// requantizes the int32 accumulators of the int8 product into float.
+
+BLIS_EXPORT_BLIS void bli_i8sgemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const float*            alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const float*            beta,
+             float*            c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_i8sgemm
+     (
+             trans_t  transa,
+             trans_t  transb,
+             dim_t    m,
+             dim_t    n,
+             dim_t    k,
+       const float*   alpha,
+       const int8_t*  a, inc_t rs_a, inc_t cs_a,
+       const int8_t*  b, inc_t rs_b, inc_t cs_b,
+       const float*   beta,
+             float*   c, inc_t rs_c, inc_t cs_c
+     );
+
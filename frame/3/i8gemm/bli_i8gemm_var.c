@@ -0,0 +1,431 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// -- int8 gemm packing --------------------------------------------------------
+//
+
+// Pack an m x k block of a matrix (where m indexes rows of A or columns of B)
+// into micropanels of mr rows, interleaving groups of four consecutive k
+// values so that each row contributes a 32-bit word per group. The k values
+// from k to k_pad, as well as rows beyond the edge of the last micropanel,
+// are zero-filled. Elements of A are stored as unsigned bytes by offsetting
+// them by 128, while elements of B keep their sign. The sum of the stored
+// elements of each row is written to sums.
+
+static void bli_i8gemm_packm
+     (
+             bool       is_a,
+             dim_t      m,
+             dim_t      k,
+             dim_t      k_pad,
+             dim_t      mr,
+       const int8_t*    x, inc_t incx, inc_t ldx,
+             uint8_t*   p,
+             int32_t*   sums,
+             thrinfo_t* thread
+     )
+{
+	const uint8_t flip   = ( is_a ? 0x80 : 0x00 );
+	const dim_t   n_iter = ( m + mr - 1 ) / mr;
+
+	const dim_t   nt     = bli_thrinfo_num_threads( thread );
+	const dim_t   tid    = bli_thrinfo_thread_id( thread );
+
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_slrr( tid, nt, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	for ( dim_t it = 0; it < n_iter; ++it )
+	{
+		if ( !bli_is_my_iter( it, it_start, it_end, tid, nt ) ) continue;
+
+		const dim_t    i0        = it * mr;
+		const dim_t    panel_dim = bli_min( mr, m - i0 );
+		      uint8_t* p_it      = p + it * mr * k_pad;
+
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			const int8_t*  x_i = x + ( i0 + i ) * incx;
+			      uint8_t* p_i = p_it + i * 4;
+			      int32_t  sum = 0;
+
+			if ( i < panel_dim )
+			{
+				for ( dim_t l = 0; l < k; ++l )
+				{
+					const uint8_t v = ( uint8_t )x_i[ l * ldx ] ^ flip;
+
+					p_i[ ( l / 4 ) * mr * 4 + l % 4 ] = v;
+					sum += ( is_a ? ( int32_t )v : ( int32_t )( int8_t )v );
+				}
+
+				for ( dim_t l = k; l < k_pad; ++l )
+					p_i[ ( l / 4 ) * mr * 4 + l % 4 ] = 0;
+			}
+			else
+			{
+				for ( dim_t l = 0; l < k_pad; ++l )
+					p_i[ ( l / 4 ) * mr * 4 + l % 4 ] = 0;
+			}
+
+			sums[ i0 + i ] = sum;
+		}
+	}
+}
+
+// Acquire a packing buffer large enough for an m_alloc x k_alloc block (with
+// m_alloc rounded up to a multiple of mr) followed by its row sums, and then
+// pack the current m x k block into it.
+
+static void bli_i8gemm_pack_block
+     (
+             bool       is_a,
+             dim_t      m_alloc,
+             dim_t      k_alloc,
+             dim_t      m,
+             dim_t      k,
+             dim_t      k_pad,
+             dim_t      mr,
+       const int8_t*    x, inc_t incx, inc_t ldx,
+             uint8_t**  p,
+             int32_t**  sums,
+             thrinfo_t* thread
+     )
+{
+	const packbuf_t pack_buf_type = ( is_a ? BLIS_BUFFER_FOR_A_BLOCK
+	                                       : BLIS_BUFFER_FOR_B_PANEL );
+
+	const dim_t     m_pack        = ( ( m_alloc + mr - 1 ) / mr ) * mr;
+	const siz_t     size_data     = m_pack * k_alloc;
+	const siz_t     size_needed   = size_data + m_pack * sizeof( int32_t );
+
+	// Barrier so that no thread repacks the buffer while its peers are still
+	// computing with the previous contents.
+	bli_thrinfo_barrier( thread );
+
+	*p    = bli_packm_alloc_ex( size_needed, pack_buf_type, thread );
+	*sums = ( int32_t* )( *p + size_data );
+
+	bli_i8gemm_packm
+	(
+	  is_a,
+	  m, k, k_pad, mr,
+	  x, incx, ldx,
+	  *p,
+	  *sums,
+	  thread
+	);
+
+	// Barrier so that packing is done before computation.
+	bli_thrinfo_barrier( thread );
+}
+
+//
+// -- int8 gemm micro-tile update ----------------------------------------------
+//
+
+// Correct an m x n micro-tile of int32 products of offset A and B for the
+// zero points, and then scale and accumulate it into C. With a' = a + 128,
+// the k-term product of one row and column expands to
+//
+//   sum( ( a - za )( b - zb ) ) = sum( a' b ) - zb sum( a' )
+//                                 - ( za + 128 )( sum( b ) - k zb )
+//
+// where sum( a' ) and sum( b ) are the row and column sums recorded while
+// packing. The correction is computed in 64-bit arithmetic so that it is
+// exact whenever the final result is representable.
+
+static void bli_i8gemm_update
+     (
+             bool              c_is_float,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const int32_t*          ab, inc_t rs_ab,
+       const int32_t*          sum_a,
+       const int32_t*          sum_b,
+             dim_t             off_m,
+             dim_t             off_n,
+       const i8gemm_qparams_t* qp,
+       const void*             alpha,
+       const void*             beta,
+             void*             c, inc_t rs_c, inc_t cs_c
+     )
+{
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		const int64_t za_i = ( qp->za ? qp->za[ ( off_m + i ) * qp->incza ] : 0 ) + 128;
+
+		for ( dim_t j = 0; j < n; ++j )
+		{
+			const int64_t zb_j = ( qp->zb ? qp->zb[ ( off_n + j ) * qp->inczb ] : 0 );
+
+			const int64_t acc  = ( int64_t )ab[ i*rs_ab + j ]
+			                   - zb_j * sum_a[ i ]
+			                   - za_i * ( sum_b[ j ] - k * zb_j );
+
+			if ( c_is_float )
+			{
+				const float alpha_l = *( const float* )alpha;
+				const float beta_l  = *( const float* )beta;
+				      float* c_ij   = ( float* )c + i*rs_c + j*cs_c;
+
+				float sa_i = ( qp->sa ? qp->sa[ ( off_m + i ) * qp->incsa ] : 1.0f );
+				float sb_j = ( qp->sb ? qp->sb[ ( off_n + j ) * qp->incsb ] : 1.0f );
+				float v    = alpha_l * sa_i * sb_j * ( float )acc;
+
+				// Don't read C when beta is zero so that NaN or Inf values are
+				// overwritten rather than propagated.
+				*c_ij = ( beta_l == 0.0f ? v : v + beta_l * *c_ij );
+			}
+			else
+			{
+				const int64_t alpha_l = *( const int32_t* )alpha;
+				const int64_t beta_l  = *( const int32_t* )beta;
+				      int32_t* c_ij   = ( int32_t* )c + i*rs_c + j*cs_c;
+
+				int64_t v = alpha_l * acc;
+
+				if ( beta_l != 0 ) v += beta_l * *c_ij;
+
+				// Reduce modulo 2^32 so that overflow wraps rather than being
+				// undefined.
+				*c_ij = ( int32_t )( uint32_t )v;
+			}
+		}
+	}
+}
+
+//
+// -- int8 gemm block-panel algorithm ------------------------------------------
+//
+
+void bli_i8gemm_bp_var1
+     (
+             bool              c_is_float,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const void*             alpha,
+       const int8_t*           a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const void*             beta,
+             void*             c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+             thrinfo_t*        thread
+     )
+{
+	const dim_t   dt_c_size = ( c_is_float ? sizeof( float ) : sizeof( int32_t ) );
+
+	const float   one_s     = 1.0f;
+	const int32_t one_i     = 1;
+	const void*   one       = ( c_is_float ? ( const void* )&one_s : ( const void* )&one_i );
+
+	/* Query the context for various blocksizes. The k dimension is always
+	   packed in groups of four, so KC is rounded down to a multiple of four. */
+	const dim_t   NR        = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_NR_I8, cntx );
+	const dim_t   MR        = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_MR_I8, cntx );
+	const dim_t   NC        = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_NC_I8, cntx );
+	const dim_t   MC        = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_MC_I8, cntx );
+	const dim_t   KC        = bli_max( bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_KC_I8, cntx ) / 4 * 4, 4 );
+
+	/* Query the context for the microkernel address and cast it to its
+	   function pointer type. */
+	i8gemm_ukr_ft i8gemm_ukr = bli_cntx_get_ukr_dt( BLIS_I8GEMM_DT, BLIS_I8GEMM_UKR, cntx );
+
+	/* The microkernel writes full MR x NR tiles to a temporary buffer, from
+	   which the zero point corrections and scaling are applied to C. */
+	int32_t ab[ BLIS_STACK_BUF_MAX_SIZE / sizeof( int32_t ) ]
+	        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+	thrinfo_t* thread_jc = bli_thrinfo_sub_node( 0, thread );
+	thrinfo_t* thread_pc = bli_thrinfo_sub_node( 0, thread_jc );
+	thrinfo_t* thread_pb = bli_thrinfo_sub_node( 0, thread_pc );
+	thrinfo_t* thread_ic = bli_thrinfo_sub_node( 0, thread_pb );
+	thrinfo_t* thread_pa = bli_thrinfo_sub_node( 0, thread_ic );
+	thrinfo_t* thread_jr = bli_thrinfo_sub_node( 0, thread_pa );
+	thrinfo_t* thread_ir = bli_thrinfo_sub_node( 0, thread_jr );
+
+	/* Compute the JC loop thread range for the current thread. */
+	dim_t jc_start, jc_end;
+	dim_t jc_tid = bli_thrinfo_work_id( thread_jc );
+	dim_t jc_nt  = bli_thrinfo_n_way( thread_jc );
+	bli_thread_range_sub( jc_tid, jc_nt, n, NR, FALSE, &jc_start, &jc_end );
+	const dim_t n_local = jc_end - jc_start;
+
+	/* Loop over the n dimension (NC columns at a time). */
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC )
+	{
+		/* Calculate the thread's current JC block dimension. */
+		const dim_t nc_cur = bli_min( NC, jc_end - jj );
+
+		/* Loop over the k dimension (KC rows/columns at a time). */
+		for ( dim_t pp = 0; pp < k; pp += KC )
+		{
+			/* Calculate the current PC block dimension and its padded
+			   extent. */
+			const dim_t kc_cur = bli_min( KC, k - pp );
+			const dim_t kc_pad = ( ( kc_cur + 3 ) / 4 ) * 4;
+
+			/* Only apply beta to the first iteration of the pc loop. */
+			const void* beta_use = ( pp == 0 ? beta : one );
+
+			uint8_t* b_pc_use;
+			int32_t* sum_b;
+
+			/* Pack the current KC x NC block of B (by columns). */
+			bli_i8gemm_pack_block
+			(
+			  FALSE,
+			  bli_min( NC, n_local ), KC,
+			  nc_cur, kc_cur, kc_pad, NR,
+			  b + jj*cs_b + pp*rs_b, cs_b, rs_b,
+			  &b_pc_use, &sum_b,
+			  thread_pb
+			);
+
+			const inc_t ps_b_use = NR * kc_pad;
+
+			/* Compute the IC loop thread range for the current thread. */
+			dim_t ic_start, ic_end;
+			dim_t ic_tid = bli_thrinfo_work_id( thread_ic );
+			dim_t ic_nt  = bli_thrinfo_n_way( thread_ic );
+			bli_thread_range_sub( ic_tid, ic_nt, m, MR, FALSE, &ic_start, &ic_end );
+			const dim_t m_local = ic_end - ic_start;
+
+			/* Loop over the m dimension (MC rows at a time). */
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+			{
+				/* Calculate the thread's current IC block dimension. */
+				const dim_t mc_cur = bli_min( MC, ic_end - ii );
+
+				uint8_t* a_ic_use;
+				int32_t* sum_a;
+
+				/* Pack the current MC x KC block of A (by rows). */
+				bli_i8gemm_pack_block
+				(
+				  TRUE,
+				  bli_min( MC, m_local ), KC,
+				  mc_cur, kc_cur, kc_pad, MR,
+				  a + ii*rs_a + pp*cs_a, rs_a, cs_a,
+				  &a_ic_use, &sum_a,
+				  thread_pa
+				);
+
+				const inc_t ps_a_use = MR * kc_pad;
+
+				/* Query the number of threads and thread ids for the JR loop. */
+				const dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+				const dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+
+				/* Compute number of primary and leftover components of the JR loop. */
+				dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+				dim_t jr_left =   nc_cur % NR;
+
+				/* Compute the JR loop thread range for the current thread. */
+				dim_t jr_start, jr_end;
+				bli_thread_range_sub( jr_tid, jr_nt, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+				/* Loop over the n dimension (NR columns at a time). */
+				for ( dim_t j = jr_start; j < jr_end; j += 1 )
+				{
+					const dim_t nr_cur
+					= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+					const uint8_t* b_jr = b_pc_use + j * ps_b_use;
+
+					/* Query the number of threads and thread ids for the IR loop. */
+					const dim_t ir_nt  = bli_thrinfo_n_way( thread_ir );
+					const dim_t ir_tid = bli_thrinfo_work_id( thread_ir );
+
+					/* Compute number of primary and leftover components of the IR loop. */
+					dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+					dim_t ir_left =   mc_cur % MR;
+
+					/* Compute the IR loop thread range for the current thread. */
+					dim_t ir_start, ir_end;
+					bli_thread_range_sub( ir_tid, ir_nt, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+					/* Loop over the m dimension (MR rows at a time). */
+					for ( dim_t i = ir_start; i < ir_end; i += 1 )
+					{
+						const dim_t mr_cur
+						= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+						const uint8_t* a_ir = a_ic_use + i * ps_a_use;
+
+						const dim_t off_m = ii + i * MR;
+						const dim_t off_n = jj + j * NR;
+
+						/* Save the addresses of next micropanels of A and B to the
+						   auxinfo_t object. */
+						auxinfo_t aux;
+						bli_auxinfo_set_next_a( a_ir + ps_a_use, &aux );
+						bli_auxinfo_set_next_b( b_jr, &aux );
+
+						/* Invoke the int8 gemm microkernel. */
+						i8gemm_ukr
+						(
+						  kc_pad,
+						  a_ir,
+						  b_jr,
+						  ab, NR,
+						  &aux,
+						  cntx
+						);
+
+						bli_i8gemm_update
+						(
+						  c_is_float,
+						  mr_cur, nr_cur, kc_cur,
+						  ab, NR,
+						  sum_a + i * MR,
+						  sum_b + j * NR,
+						  off_m, off_n,
+						  qparams,
+						  alpha,
+						  beta_use,
+						  ( char* )c + ( off_m*rs_c + off_n*cs_c ) * dt_c_size, rs_c, cs_c
+						);
+					}
+				}
+			}
+		}
+	}
+}
+
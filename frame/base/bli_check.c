@@ -149,7 +149,9 @@ err_t bli_check_valid_datatype( num_t dt )
 	     dt != BLIS_SCOMPLEX &&
 	     dt != BLIS_DCOMPLEX &&
 	     dt != BLIS_INT &&
-	     dt != BLIS_CONSTANT )
+	     dt != BLIS_CONSTANT &&
+	     dt != BLIS_BFLOAT &&
+	     dt != BLIS_HFLOAT )
 		e_val = BLIS_INVALID_DATATYPE;
 
 	return e_val;
@@ -232,6 +234,28 @@ err_t bli_check_floating_object( const obj_t* a )
 	return e_val;
 }
 
+err_t bli_check_floating_or_half_datatype( num_t dt )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( bli_check_floating_datatype( dt ) != BLIS_SUCCESS &&
+	     !bli_is_half_prec( dt ) )
+		e_val = BLIS_EXPECTED_FLOATING_POINT_DATATYPE;
+
+	return e_val;
+}
+
+err_t bli_check_floating_or_half_object( const obj_t* a )
+{
+	err_t e_val;
+	num_t dt;
+
+	dt = bli_obj_dt( a );
+	e_val = bli_check_floating_or_half_datatype( dt );
+
+	return e_val;
+}
+
 err_t bli_check_real_datatype( num_t dt )
 {
 	err_t e_val = BLIS_SUCCESS;
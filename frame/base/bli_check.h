@@ -54,6 +54,8 @@ err_t bli_check_nonconstant_datatype( num_t dt );
 err_t bli_check_nonconstant_object( const obj_t* a );
 err_t bli_check_floating_datatype( num_t dt );
 err_t bli_check_floating_object( const obj_t* a );
+err_t bli_check_floating_or_half_datatype( num_t dt );
+err_t bli_check_floating_or_half_object( const obj_t* a );
 err_t bli_check_real_datatype( num_t dt );
 err_t bli_check_real_object( const obj_t* a );
 err_t bli_check_integer_datatype( num_t dt );
@@ -51,6 +51,7 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 	[-BLIS_INVALID_CONJ]                         = "Invalid conj_t parameter value.",
 	[-BLIS_INVALID_DIAG]                         = "Invalid diag_t parameter value.",
 	[-BLIS_EXPECTED_NONUNIT_DIAG]                = "Expected object with non-unit diagonal.",
+	[-BLIS_INVALID_ACTIVATION]                   = "Invalid activation function value in epilogue.",
 
 	[-BLIS_INVALID_DATATYPE]                     = "Invalid datatype value.",
 	[-BLIS_EXPECTED_FLOATING_POINT_DATATYPE]     = "Expected floating-point datatype value.",
@@ -93,6 +94,9 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK] = "Pack schema not yet supported/implemented for use with unpacking.",
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART]   = "Pack schema not yet supported/implemented for use with partitioning.",
+	[-BLIS_PACKED_OBJECT_BLKSZ_MISMATCH]         = "Pre-packed object was packed with a datatype, pack schema, or register blocksizes that differ from those of the current operation.",
+	[-BLIS_INVALID_PACKED_OBJECT_VIEW]           = "Pre-packed object may not be transposed, conjugated, or used as a submatrix view.",
+	[-BLIS_PACKED_OBJECT_REQUIRES_SUP]           = "Small/unpacked (sup) code path, for which the operand was (or would be) pre-packed, is unavailable for this operation, datatype, or configuration.",
 
 	[-BLIS_EXPECTED_NONNULL_OBJECT_BUFFER]       = "Encountered object with non-zero dimensions containing null buffer.",
 
@@ -171,6 +171,132 @@ const cntx_t* bli_gks_lookup_id
 
 // -----------------------------------------------------------------------------
 
+static void bli_gks_set_sup_thresh_from_profile
+     (
+             arch_t  id,
+       const char*   profile,
+             cntx_t* cntx
+     )
+{
+	// Parse a sup threshold profile, such as the one written by the
+	// test/tune driver, and apply its entries to the context. Entries are
+	// separated by newlines or semicolons, and each has the form
+	//
+	//   [arch] dt mt nt kt
+	//
+	// where dt is one of s, d, c, or z, and mt, nt, and kt are the values
+	// of the BLIS_MT, BLIS_NT, and BLIS_KT thresholds for that datatype. An
+	// entry that names an architecture only applies to the context for that
+	// architecture. Text following a '#' is ignored, as are entries that are
+	// not of the above form.
+	const char* entry = profile;
+
+	while ( *entry != '\0' )
+	{
+		size_t len = strcspn( entry, "\n;" );
+		char   buf[ 256 ];
+
+		memcpy( buf, entry, bli_min( len, sizeof( buf ) - 1 ) );
+		buf[ bli_min( len, sizeof( buf ) - 1 ) ] = '\0';
+		buf[ strcspn( buf, "#" ) ] = '\0';
+
+		entry += len;
+		if ( *entry != '\0' ) ++entry;
+
+		char  tok[ 5 ][ 32 ];
+		int   n_tok = sscanf( buf, "%31s %31s %31s %31s %31s",
+		                      tok[ 0 ], tok[ 1 ], tok[ 2 ], tok[ 3 ], tok[ 4 ] );
+		int   i     = 0;
+
+		if ( n_tok == 5 )
+		{
+			if ( strcasecmp( tok[ 0 ], bli_arch_string( id ) ) != 0 ) continue;
+			i = 1;
+		}
+		else if ( n_tok != 4 ) continue;
+
+		num_t dt;
+		if      ( strcmp( tok[ i ], "s" ) == 0 ) dt = BLIS_FLOAT;
+		else if ( strcmp( tok[ i ], "d" ) == 0 ) dt = BLIS_DOUBLE;
+		else if ( strcmp( tok[ i ], "c" ) == 0 ) dt = BLIS_SCOMPLEX;
+		else if ( strcmp( tok[ i ], "z" ) == 0 ) dt = BLIS_DCOMPLEX;
+		else continue;
+
+		dim_t thresh[ 3 ];
+		bool  valid = TRUE;
+
+		for ( int j = 0; j < 3; ++j )
+		{
+			char* end;
+			thresh[ j ] = ( dim_t )strtol( tok[ i + 1 + j ], &end, 10 );
+			if ( end == tok[ i + 1 + j ] || *end != '\0' || thresh[ j ] < 0 )
+				valid = FALSE;
+		}
+
+		if ( !valid ) continue;
+
+		// Ignore entries for datatypes for which the sub-configuration does
+		// not register sup kernels, since the sup code path cannot handle
+		// them regardless of the thresholds.
+		if ( bli_cntx_get_blksz_def_dt( dt, BLIS_MR_SUP, cntx ) <= 0 ||
+		     bli_cntx_get_blksz_def_dt( dt, BLIS_NR_SUP, cntx ) <= 0 ) continue;
+
+		const kerid_t bs_ids[ 3 ] = { BLIS_MT, BLIS_NT, BLIS_KT };
+
+		for ( int j = 0; j < 3; ++j )
+		{
+			bli_cntx_set_blksz_def_dt( dt, bs_ids[ j ], thresh[ j ], cntx );
+			bli_cntx_set_blksz_max_dt( dt, bs_ids[ j ], thresh[ j ], cntx );
+		}
+	}
+}
+
+static void bli_gks_set_sup_thresh_from_env
+     (
+       arch_t  id,
+       cntx_t* cntx
+     )
+{
+	// A sup threshold profile may be given as the name of a file, via
+	// BLIS_SUP_THRESH_FILE, and/or as a string, via BLIS_SUP_THRESH. Since
+	// the latter is applied last, its entries take precedence.
+	const char* path = bli_env_get_str( "BLIS_SUP_THRESH_FILE" );
+
+	if ( path != NULL )
+	{
+		FILE* file = fopen( path, "r" );
+
+		if ( file != NULL )
+		{
+			err_t r_val;
+			long  size    = ( fseek( file, 0, SEEK_END ) == 0 ? ftell( file ) : -1 );
+			char* profile = NULL;
+
+			if ( size >= 0 && fseek( file, 0, SEEK_SET ) == 0 )
+				profile = bli_malloc_intl( ( size_t )size + 1, &r_val );
+
+			if ( profile != NULL )
+			{
+				size_t n_read = fread( profile, 1, ( size_t )size, file );
+				profile[ n_read ] = '\0';
+
+				bli_gks_set_sup_thresh_from_profile( id, profile, cntx );
+
+				bli_free_intl( profile );
+			}
+
+			fclose( file );
+		}
+	}
+
+	const char* profile = bli_env_get_str( "BLIS_SUP_THRESH" );
+
+	if ( profile != NULL )
+		bli_gks_set_sup_thresh_from_profile( id, profile, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_gks_register_cntx
      (
        arch_t  id,
@@ -230,6 +356,10 @@ void bli_gks_register_cntx
 	// allocated array corresponding to native execution.
 	f( gks_id );
 
+	// Override the sup thresholds set by the sub-configuration with those
+	// of a tuned profile, if one was provided.
+	bli_gks_set_sup_thresh_from_env( id, gks_id );
+
 	// Verify that cache blocksizes are whole multiples of register blocksizes.
 	// Specifically, verify that:
 	//   - MC is a whole multiple of MR.
@@ -115,6 +115,16 @@ void bli_obj_create_without_buffer
 
 	// Set the internal scalar to 1.0.
 	bli_obj_set_scalar_dt( dt, obj );
+
+	// Half-precision (bfloat16 and float16) objects are only ever computed
+	// on in single precision, which is also where we keep their scalars.
+	if ( bli_is_half_prec( dt ) )
+	{
+		bli_obj_set_comp_prec( BLIS_SINGLE_PREC, obj );
+		bli_obj_set_scalar_dt( BLIS_FLOAT, obj );
+		dt = BLIS_FLOAT;
+	}
+
 	void* s = bli_obj_internal_scalar_buffer( obj );
 
 	// Always writing the imaginary component is needed in mixed-domain
@@ -508,14 +518,17 @@ void bli_adjust_strides
 	}
 }
 
-static siz_t dt_sizes[6] =
+static siz_t dt_sizes[BLIS_HFLOAT+1] =
 {
 	sizeof( float ),
 	sizeof( scomplex ),
 	sizeof( double ),
 	sizeof( dcomplex ),
 	sizeof( gint_t ),
-	sizeof( constdata_t )
+	sizeof( constdata_t ),
+	sizeof( bfloat ),
+	0,
+	sizeof( hfloat )
 };
 
 siz_t bli_dt_size
@@ -529,13 +542,17 @@ siz_t bli_dt_size
 	return dt_sizes[dt];
 }
 
-static char* dt_names[ BLIS_NUM_FP_TYPES+1 ] =
+static char* dt_names[ BLIS_HFLOAT+1 ] =
 {
 	"float",
 	"scomplex",
 	"double",
 	"dcomplex",
-	"int"
+	"int",
+	NULL,
+	"bfloat16",
+	NULL,
+	"float16"
 };
 
 const char* bli_dt_string
@@ -165,6 +165,8 @@ void bli_param_map_char_to_blis_dt( char dt, num_t* blis_dt )
 	else if ( dt == 'c' ) *blis_dt = BLIS_SCOMPLEX;
 	else if ( dt == 'z' ) *blis_dt = BLIS_DCOMPLEX;
 	else if ( dt == 'i' ) *blis_dt = BLIS_INT;
+	else if ( dt == 'b' ) *blis_dt = BLIS_BFLOAT;
+	else if ( dt == 'h' ) *blis_dt = BLIS_HFLOAT;
 	else
 	{
 		bli_check_error_code( BLIS_INVALID_DATATYPE );
@@ -233,6 +235,8 @@ void bli_param_map_blis_to_char_dt( num_t blis_dt, char* dt )
 	else if ( blis_dt == BLIS_SCOMPLEX ) *dt = 'c';
 	else if ( blis_dt == BLIS_DCOMPLEX ) *dt = 'z';
 	else if ( blis_dt == BLIS_INT      ) *dt = 'i';
+	else if ( blis_dt == BLIS_BFLOAT   ) *dt = 'b';
+	else if ( blis_dt == BLIS_HFLOAT   ) *dt = 'h';
 	else
 	{
 		bli_check_error_code( BLIS_INVALID_DATATYPE );
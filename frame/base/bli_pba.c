@@ -34,10 +34,178 @@
 
 */
 
+#if defined(__linux__)
+// Request the declarations of getcpu() and syscall(), which are used to
+// determine the NUMA node of the calling thread.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sched.h>
+
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2,29)
+#define BLIS_PBA_HAVE_GETCPU
+#endif
+#endif
+#endif
+
 #include "blis.h"
 
-// Statically initialize the mutex within the packing block allocator object.
-static pba_t global_pba = { .mutex = BLIS_PTHREAD_MUTEX_INITIALIZER };
+// The mutexes within the packing block allocator object are initialized by
+// bli_pba_init() since there is one per NUMA node.
+static pba_t global_pba;
+
+// -----------------------------------------------------------------------------
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+#define __ATOMIC_RELEASE
+
+#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
+#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
+#define __atomic_store_n(   ptr, value, constraint ) \
+        do { __sync_synchronize(); *(ptr) = (value); __sync_synchronize(); } while ( 0 )
+#define __atomic_compare_exchange_n( ptr, expected, desired, weak, success, failure ) \
+        __sync_bool_compare_and_swap( ptr, *(expected), desired )
+
+#endif
+
+// Possible states of a pba_slot_t.
+#define BLIS_PBA_SLOT_EMPTY 0
+#define BLIS_PBA_SLOT_BUSY  1
+#define BLIS_PBA_SLOT_FULL  2
+
+// Each application thread is assigned a slot index the first time it
+// checks out a block. Threads are assigned indices in round-robin fashion,
+// so threads only share slots if there are more than BLIS_PBA_CACHE_SLOTS
+// of them.
+static gint_t                  pba_slot_counter = 0;
+static BLIS_THREAD_LOCAL dim_t pba_slot_index   = -1;
+
+static dim_t bli_pba_query_slot_index( void )
+{
+	if ( pba_slot_index < 0 )
+		pba_slot_index = __atomic_fetch_add( &pba_slot_counter, 1, __ATOMIC_RELAXED ) %
+		                 BLIS_PBA_CACHE_SLOTS;
+
+	return pba_slot_index;
+}
+
+static bool bli_pba_slot_move
+     (
+       gint_t      from_state,
+       gint_t      to_state,
+       pblk_t*     block,
+       pba_slot_t* slot
+     )
+{
+	// Try to move a block into an empty slot (if from_state is EMPTY) or out
+	// of a full slot (if from_state is FULL). We first claim the slot by
+	// marking it busy, which fails without blocking if the slot is not in
+	// the expected state or if some other thread claims it first.
+	if ( __atomic_load_n( &slot->state, __ATOMIC_RELAXED ) != from_state )
+		return FALSE;
+
+	gint_t expected = from_state;
+
+	if ( !__atomic_compare_exchange_n( &slot->state, &expected, BLIS_PBA_SLOT_BUSY,
+	                                   FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+		return FALSE;
+
+	if ( to_state == BLIS_PBA_SLOT_FULL ) slot->block = *block;
+	else                                  *block = slot->block;
+
+	__atomic_store_n( &slot->state, to_state, __ATOMIC_RELEASE );
+
+	return TRUE;
+}
+
+static void bli_pba_drain_cache
+     (
+       pba_node_t* node
+     )
+{
+	// Check any cached blocks back into their pools. This function must only
+	// be called while no other threads are using the pba.
+	for ( dim_t pi = 0; pi < 3; ++pi )
+	{
+		pool_t* pool = bli_pba_pool( pi, node );
+
+		for ( dim_t i = 0; i < BLIS_PBA_CACHE_SLOTS; ++i )
+		{
+			pba_slot_t* slot = bli_pba_slot( pi, i, node );
+
+			if ( slot->state == BLIS_PBA_SLOT_FULL )
+				bli_pool_checkin_block( &slot->block, pool );
+
+			slot->state = BLIS_PBA_SLOT_EMPTY;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_pba_detect_num_nodes( void )
+{
+	dim_t num_nodes = 1;
+
+#if defined(__linux__)
+	// The kernel lists the range of NUMA node ids that may ever be online,
+	// e.g. "0-1", in this file. We take the last id in the list as the
+	// highest one.
+	FILE* fp = fopen( "/sys/devices/system/node/possible", "r" );
+
+	if ( fp != NULL )
+	{
+		char buf[ 256 ];
+
+		if ( fgets( buf, sizeof( buf ), fp ) != NULL )
+		{
+			char* p = buf + strcspn( buf, "\n" );
+			while ( buf < p && '0' <= p[ -1 ] && p[ -1 ] <= '9' ) --p;
+
+			num_nodes = atoi( p ) + 1;
+		}
+
+		fclose( fp );
+	}
+#endif
+
+	return bli_max( 1, bli_min( num_nodes, BLIS_NUMA_MAX_NODES ) );
+}
+
+dim_t bli_pba_query_node
+     (
+       const pba_t* pba
+     )
+{
+	// Skip the query if there is only one set of pools.
+	if ( bli_pba_num_nodes( pba ) == 1 ) return 0;
+
+	unsigned int node = 0;
+
+#if defined(__linux__)
+	unsigned int cpu;
+
+	// Prefer getcpu() (which avoids entering the kernel) if the C library
+	// provides it.
+	#ifdef BLIS_PBA_HAVE_GETCPU
+	if ( getcpu( &cpu, &node ) != 0 ) node = 0;
+	#else
+	if ( syscall( SYS_getcpu, &cpu, &node, NULL ) != 0 ) node = 0;
+	#endif
+#endif
+
+	// Threads on nodes beyond BLIS_NUMA_MAX_NODES share pools with
+	// lower-numbered nodes.
+	return ( dim_t )node % bli_pba_num_nodes( pba );
+}
 
 // -----------------------------------------------------------------------------
 
@@ -63,13 +231,29 @@ void bli_pba_init
 	bli_pba_set_malloc_fp( malloc_fp, pba );
 	bli_pba_set_free_fp( free_fp, pba );
 
-	// The mutex field of pba is initialized statically above. This
-	// keeps bli_pba_init() simpler and removes the possibility of
-	// something going wrong during mutex initialization.
+	// Determine whether pool blocks should be backed by huge pages.
+	bli_pba_set_use_huge_pages( bli_env_get_var( "BLIS_HUGE_PAGES",
+	                                             BLIS_HUGE_PAGES_DEFAULT ) != 0,
+	                            pba );
+
+	// Determine the number of NUMA nodes, each of which gets its own set
+	// of pools.
+	bli_pba_set_num_nodes( bli_pba_detect_num_nodes(), pba );
+
+	for ( dim_t i = 0; i < bli_pba_num_nodes( pba ); ++i )
+	{
+		pba_node_t* node = bli_pba_node( i, pba );
+
+		bli_pba_init_mutex( node );
+
+		for ( dim_t pi = 0; pi < 3; ++pi )
+			for ( dim_t j = 0; j < BLIS_PBA_CACHE_SLOTS; ++j )
+				bli_pba_slot( pi, j, node )->state = BLIS_PBA_SLOT_EMPTY;
 
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_pba_init_pools( cntx, pba );
+		bli_pba_init_pools( cntx, node );
 #endif
+	}
 }
 
 void bli_pba_finalize
@@ -79,12 +263,19 @@ void bli_pba_finalize
 {
 	pba_t* pba = bli_pba_query();
 
+	for ( dim_t i = 0; i < bli_pba_num_nodes( pba ); ++i )
+	{
+		pba_node_t* node = bli_pba_node( i, pba );
+
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_pba_finalize_pools( pba );
+		bli_pba_drain_cache( node );
+		bli_pba_finalize_pools( node );
 #endif
 
-	// The mutex field of pba is initialized statically above, and
-	// therefore never destroyed.
+		bli_pba_finalize_mutex( node );
+	}
+
+	bli_pba_set_num_nodes( 0, pba );
 
 	bli_pba_set_malloc_fp( NULL, pba );
 	bli_pba_set_free_fp( NULL, pba );
@@ -138,20 +329,42 @@ void bli_pba_acquire_m
 		// from an internal memory pool, in which blocks are allocated once
 		// and then recycled.
 
+		// Select the set of pools that belongs to the NUMA node on which the
+		// calling thread is running. Since pool blocks are not touched when
+		// they are allocated, their pages are placed (upon first touch) on
+		// the node of the threads that pack into them, and the per-node pools
+		// ensure that they are subsequently recycled only on that node.
+		pba_node_t* node = bli_pba_node( bli_pba_query_node( pba ), pba );
+
 		// Map the requested packed buffer type to a zero-based index, which
 		// we then use to select the corresponding memory pool.
 		dim_t   pi   = bli_packbuf_index( buf_type );
-		pool_t* pool = bli_pba_pool( pi, pba );
+		pool_t* pool = bli_pba_pool( pi, node );
 
 		// Extract the address of the pblk_t struct within the mem_t.
 		pblk_t* pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the pba object.
-		bli_pba_lock( pba );
+		// In the common case, the calling thread recently returned a block
+		// to the cache that is large enough, and we can reuse that block
+		// without acquiring the mutex.
+		pba_slot_t* slot = bli_pba_slot( pi, bli_pba_query_slot_index(), node );
+		bool        hit  = bli_pba_slot_move( BLIS_PBA_SLOT_FULL, BLIS_PBA_SLOT_EMPTY,
+		                                      pblk, slot );
+
+		if ( !hit || bli_pblk_block_size( pblk ) < req_size )
+		{
+
+		// Acquire the mutex associated with the node.
+		bli_pba_lock( node );
 
 		// BEGIN CRITICAL SECTION
 		{
 
+			// If we took a block from the cache that turned out to be too
+			// small, check it back in first. (The pool will free it if it has
+			// since been reinitialized with a larger block size.)
+			if ( hit ) bli_pool_checkin_block( pblk, pool );
+
 			// Checkout a block from the pool. If the pool's blocks are too
 			// small, it will be reinitialized with blocks large enough to
 			// accommodate the requested block size. If the pool is exhausted,
@@ -165,8 +378,10 @@ void bli_pba_acquire_m
 		}
 		// END CRITICAL SECTION
 
-		// Release the mutex associated with the pba object.
-		bli_pba_unlock( pba );
+		// Release the mutex associated with the node.
+		bli_pba_unlock( node );
+
+		}
 
 		// Query the block_size from the pblk_t. This will be at least
 		// req_size, perhaps larger.
@@ -221,8 +436,26 @@ void bli_pba_release
 		// Extract the address of the pblk_t struct within the mem_t struct.
 		pblk_t* pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the pba object.
-		bli_pba_lock( pba );
+		// Find the node that owns the pool. Note that this need not be the
+		// node on which the calling thread is currently running.
+		pba_node_t* node = bli_pba_node_of_pool( pool, pba );
+
+		// If the block is of the size currently in use by the pool, try to
+		// place it in the calling thread's slot of the cache, from which the
+		// thread may later check it out again without acquiring the mutex.
+		dim_t       pi   = bli_packbuf_index( buf_type );
+		pba_slot_t* slot = bli_pba_slot( pi, bli_pba_query_slot_index(), node );
+
+		if ( bli_pblk_block_size( pblk ) ==
+		     __atomic_load_n( &pool->block_size, __ATOMIC_RELAXED ) &&
+		     bli_pba_slot_move( BLIS_PBA_SLOT_EMPTY, BLIS_PBA_SLOT_FULL, pblk, slot ) )
+		{
+			bli_mem_clear( mem );
+			return;
+		}
+
+		// Acquire the mutex associated with the node.
+		bli_pba_lock( node );
 
 		// BEGIN CRITICAL SECTION
 		{
@@ -233,8 +466,8 @@ void bli_pba_release
 		}
 		// END CRITICAL SECTION
 
-		// Release the mutex associated with the pba object.
-		bli_pba_unlock( pba );
+		// Release the mutex associated with the node.
+		bli_pba_unlock( node );
 	}
 
 	// Clear the mem_t object so that it appears unallocated. This clears:
@@ -283,18 +516,22 @@ siz_t bli_pba_pool_size
 	}
 	else
 	{
-		dim_t   pool_index;
-		pool_t* pool;
-
-		// Acquire the pointer to the pool corresponding to the buf_type
-		// provided.
-		pool_index = bli_packbuf_index( buf_type );
-		pool       = bli_pba_pool( pool_index, ( pba_t* )pba );
-
-		// Compute the pool "size" as the product of the block size
-		// and the number of blocks in the pool.
-		r_val = bli_pool_block_size( pool ) *
-		        bli_pool_num_blocks( pool );
+		dim_t pool_index = bli_packbuf_index( buf_type );
+
+		r_val = 0;
+
+		// Sum over the pools corresponding to the buf_type provided on all
+		// of the NUMA nodes.
+		for ( dim_t i = 0; i < bli_pba_num_nodes( pba ); ++i )
+		{
+			pba_node_t* node = bli_pba_node( i, ( pba_t* )pba );
+			pool_t*     pool = bli_pba_pool( pool_index, node );
+
+			// Compute the pool "size" as the product of the block size
+			// and the number of blocks in the pool.
+			r_val += bli_pool_block_size( pool ) *
+			         bli_pool_num_blocks( pool );
+		}
 	}
 
 	return r_val;
@@ -302,10 +539,133 @@ siz_t bli_pba_pool_size
 
 // -----------------------------------------------------------------------------
 
+void bli_pba_get_huge_pages( bool* huge_pages )
+{
+	// We must ensure that the global pba has been initialized.
+	bli_init_once();
+
+	*huge_pages = bli_pba_use_huge_pages( bli_pba_query() );
+}
+
+void bli_pba_set_huge_pages( bool huge_pages )
+{
+	// We must ensure that the global pba has been initialized (otherwise
+	// bli_pba_init() would later overwrite the value we set here).
+	bli_init_once();
+
+	// NOTE: Blocks that are already in the pools are not reallocated. The
+	// new setting only applies to blocks that are allocated from now on,
+	// for example when a pool grows or is reinitialized with larger blocks.
+	__atomic_store_n( &(bli_pba_query()->huge_pages), huge_pages,
+	                  __ATOMIC_RELAXED );
+}
+
+// -----------------------------------------------------------------------------
+
+// Every pool block is allocated with a small header that records how the
+// block was allocated so that it can be freed correctly even if the huge
+// page setting changes while the block is in use.
+
+#define BLIS_PBA_ALLOC_POOL    0
+#define BLIS_PBA_ALLOC_HUGETLB 1
+#define BLIS_PBA_ALLOC_THP     2
+
+typedef struct
+{
+	void*  base;
+	size_t size;
+	int    kind;
+
+} pba_block_hdr_t;
+
+#define BLIS_PBA_BLOCK_HDR_SIZE BLIS_CACHE_LINE_SIZE
+
+static void* bli_pba_malloc_pool( size_t size )
+{
+	void*  base      = NULL;
+	size_t full_size = size + BLIS_PBA_BLOCK_HDR_SIZE;
+	int    kind      = BLIS_PBA_ALLOC_POOL;
+
+#if defined(__linux__)
+	if ( __atomic_load_n( &(bli_pba_query()->huge_pages), __ATOMIC_RELAXED ) )
+	{
+		// Round the size up to a whole number of huge pages.
+		const size_t huge_size = ( ( full_size + BLIS_HUGE_PAGE_SIZE - 1 ) /
+		                           BLIS_HUGE_PAGE_SIZE ) * BLIS_HUGE_PAGE_SIZE;
+
+		#ifdef MAP_HUGETLB
+		// First try to map explicitly reserved huge pages. This fails (for
+		// example) if no huge pages have been reserved by the administrator
+		// via /proc/sys/vm/nr_hugepages.
+		base = mmap( NULL, huge_size, PROT_READ | PROT_WRITE,
+		             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+		if ( base == MAP_FAILED ) base = NULL;
+		else { kind = BLIS_PBA_ALLOC_HUGETLB; full_size = huge_size; }
+		#endif
+
+		// Otherwise, allocate memory aligned to a huge page boundary and ask
+		// the kernel to back it with transparent huge pages. If madvise()
+		// fails (e.g. because transparent huge pages are disabled), we
+		// simply end up with regular pages.
+		if ( base == NULL &&
+		     posix_memalign( &base, BLIS_HUGE_PAGE_SIZE, huge_size ) == 0 )
+		{
+			#ifdef MADV_HUGEPAGE
+			madvise( base, huge_size, MADV_HUGEPAGE );
+			#endif
+
+			kind = BLIS_PBA_ALLOC_THP; full_size = huge_size;
+		}
+	}
+#endif
+
+	// Fall back to the malloc() designated (at configure-time) for pools.
+	if ( base == NULL )
+	{
+		base = BLIS_MALLOC_POOL( full_size );
+		if ( base == NULL ) return NULL;
+	}
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_pba_malloc_pool(): size %ld, kind %d\n",
+	        ( long )full_size, kind );
+	fflush( stdout );
+	#endif
+
+	pba_block_hdr_t* hdr = base;
+
+	hdr->base = base;
+	hdr->size = full_size;
+	hdr->kind = kind;
+
+	return ( char* )base + BLIS_PBA_BLOCK_HDR_SIZE;
+}
+
+static void bli_pba_free_pool( void* p )
+{
+	pba_block_hdr_t* hdr = ( pba_block_hdr_t* )( ( char* )p - BLIS_PBA_BLOCK_HDR_SIZE );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_pba_free_pool(): size %ld, kind %d\n",
+	        ( long )hdr->size, hdr->kind );
+	fflush( stdout );
+	#endif
+
+#if defined(__linux__)
+	if      ( hdr->kind == BLIS_PBA_ALLOC_HUGETLB ) munmap( hdr->base, hdr->size );
+	else if ( hdr->kind == BLIS_PBA_ALLOC_THP     ) free( hdr->base );
+	else
+#endif
+	BLIS_FREE_POOL( hdr->base );
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_pba_init_pools
      (
-       const cntx_t* cntx,
-             pba_t*  pba
+       const cntx_t*     cntx,
+             pba_node_t* node
      )
 {
 	// Map each of the packbuf_t values to an index starting at zero.
@@ -314,9 +674,9 @@ void bli_pba_init_pools
 	const dim_t index_c      = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
 	// Alias the pool addresses to convenient identifiers.
-	pool_t*     pool_a       = bli_pba_pool( index_a, pba );
-	pool_t*     pool_b       = bli_pba_pool( index_b, pba );
-	pool_t*     pool_c       = bli_pba_pool( index_c, pba );
+	pool_t*     pool_a       = bli_pba_pool( index_a, node );
+	pool_t*     pool_b       = bli_pba_pool( index_b, node );
+	pool_t*     pool_c       = bli_pba_pool( index_c, node );
 
 	// Start with empty pools.
 	const dim_t num_blocks_a = 0;
@@ -343,9 +703,10 @@ void bli_pba_init_pools
 	const siz_t offset_size_b = BLIS_POOL_ADDR_OFFSET_SIZE_B;
 	const siz_t offset_size_c = BLIS_POOL_ADDR_OFFSET_SIZE_C;
 
-	// Use the malloc() and free() designated (at configure-time) for pools.
-	malloc_ft malloc_fp  = BLIS_MALLOC_POOL;
-	free_ft   free_fp    = BLIS_FREE_POOL;
+	// Use the wrappers around the malloc() and free() designated (at
+	// configure-time) for pools, which optionally use huge pages instead.
+	malloc_ft malloc_fp  = bli_pba_malloc_pool;
+	free_ft   free_fp    = bli_pba_free_pool;
 
 	// Determine the block size for each memory pool.
 	bli_pba_compute_pool_block_sizes( &block_size_a,
@@ -364,7 +725,7 @@ void bli_pba_init_pools
 
 void bli_pba_finalize_pools
      (
-       pba_t* pba
+       pba_node_t* node
      )
 {
 	// Map each of the packbuf_t values to an index starting at zero.
@@ -373,9 +734,9 @@ void bli_pba_finalize_pools
 	dim_t   index_c = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
 	// Alias the pool addresses to convenient identifiers.
-	pool_t* pool_a  = bli_pba_pool( index_a, pba );
-	pool_t* pool_b  = bli_pba_pool( index_b, pba );
-	pool_t* pool_c  = bli_pba_pool( index_c, pba );
+	pool_t* pool_a  = bli_pba_pool( index_a, node );
+	pool_t* pool_b  = bli_pba_pool( index_b, node );
+	pool_t* pool_c  = bli_pba_pool( index_c, node );
 
 	// Finalize the memory pools for A, B, and C.
 	bli_pool_finalize( pool_a, FALSE );
@@ -40,37 +40,75 @@
 // Packing block allocator (formerly memory broker)
 
 /*
-typedef struct pba_s
+typedef struct pba_node_s
 {
 	pool_t              pools[3];
 	bli_pthread_mutex_t mutex;
 
+	pba_slot_t          cache[3][ BLIS_PBA_CACHE_SLOTS ];
+
+	char                padding[ BLIS_CACHE_LINE_SIZE ];
+
+} pba_node_t;
+
+typedef struct pba_s
+{
+	pba_node_t          nodes[ BLIS_NUMA_MAX_NODES ];
+	dim_t               num_nodes;
+
 	// These fields are used for general-purpose allocation.
 	siz_t               align_size;
 	malloc_ft           malloc_fp;
 	free_ft             free_fp;
 
+	bool                huge_pages;
+
 } pba_t;
 */
 
 
 // pba init
 
-//BLIS_INLINE void bli_pba_init_mutex( pba_t* pba )
-//{
-//	bli_pthread_mutex_init( &(pba->mutex), NULL );
-//}
+BLIS_INLINE void bli_pba_init_mutex( pba_node_t* node )
+{
+	bli_pthread_mutex_init( &(node->mutex), NULL );
+}
 
-//BLIS_INLINE void bli_pba_finalize_mutex( pba_t* pba )
-//{
-//	bli_pthread_mutex_destroy( &(pba->mutex) );
-//}
+BLIS_INLINE void bli_pba_finalize_mutex( pba_node_t* node )
+{
+	bli_pthread_mutex_destroy( &(node->mutex) );
+}
 
 // pba query
 
-BLIS_INLINE pool_t* bli_pba_pool( dim_t pool_index, pba_t* pba )
+BLIS_INLINE dim_t bli_pba_num_nodes( const pba_t* pba )
+{
+	return pba->num_nodes;
+}
+
+BLIS_INLINE pba_node_t* bli_pba_node( dim_t node_index, pba_t* pba )
+{
+	return &(pba->nodes[ node_index ]);
+}
+
+BLIS_INLINE pool_t* bli_pba_pool( dim_t pool_index, pba_node_t* node )
+{
+	return &(node->pools[ pool_index ]);
+}
+
+BLIS_INLINE pba_slot_t* bli_pba_slot( dim_t pool_index, dim_t slot_index, pba_node_t* node )
+{
+	return &(node->cache[ pool_index ][ slot_index ]);
+}
+
+BLIS_INLINE pba_node_t* bli_pba_node_of_pool( pool_t* pool, pba_t* pba )
 {
-	return &(pba->pools[ pool_index ]);
+	// Each pool_t is embedded within the pba_node_t to which it belongs, so
+	// we can recover the node from the pool's address.
+	const dim_t node_index = ( dim_t )( ( ( char* )pool - ( char* )pba->nodes ) /
+	                                    sizeof( pba_node_t ) );
+
+	return bli_pba_node( node_index, pba );
 }
 
 BLIS_INLINE siz_t bli_pba_align_size( const pba_t* pba )
@@ -88,8 +126,18 @@ BLIS_INLINE free_ft bli_pba_free_fp( const pba_t* pba )
 	return pba->free_fp;
 }
 
+BLIS_INLINE bool bli_pba_use_huge_pages( const pba_t* pba )
+{
+	return pba->huge_pages;
+}
+
 // pba modification
 
+BLIS_INLINE void bli_pba_set_num_nodes( dim_t num_nodes, pba_t* pba )
+{
+	pba->num_nodes = num_nodes;
+}
+
 BLIS_INLINE void bli_pba_set_align_size( siz_t align_size, pba_t* pba )
 {
 	pba->align_size = align_size;
@@ -105,16 +153,21 @@ BLIS_INLINE void bli_pba_set_free_fp( free_ft free_fp, pba_t* pba )
 	pba->free_fp = free_fp;
 }
 
+BLIS_INLINE void bli_pba_set_use_huge_pages( bool huge_pages, pba_t* pba )
+{
+	pba->huge_pages = huge_pages;
+}
+
 // pba action
 
-BLIS_INLINE void bli_pba_lock( pba_t* pba )
+BLIS_INLINE void bli_pba_lock( pba_node_t* node )
 {
-	bli_pthread_mutex_lock( &(pba->mutex) );
+	bli_pthread_mutex_lock( &(node->mutex) );
 }
 
-BLIS_INLINE void bli_pba_unlock( pba_t* pba )
+BLIS_INLINE void bli_pba_unlock( pba_node_t* node )
 {
-	bli_pthread_mutex_unlock( &(pba->mutex) );
+	bli_pthread_mutex_unlock( &(node->mutex) );
 }
 
 // -----------------------------------------------------------------------------
@@ -150,16 +203,24 @@ siz_t bli_pba_pool_size
              packbuf_t buf_type
      );
 
+BLIS_EXPORT_BLIS void bli_pba_get_huge_pages( bool* huge_pages );
+BLIS_EXPORT_BLIS void bli_pba_set_huge_pages( bool huge_pages );
+
 // ----------------------------------------------------------------------------
 
+dim_t bli_pba_query_node
+     (
+       const pba_t* pba
+     );
+
 void bli_pba_init_pools
      (
-       const cntx_t* cntx,
-             pba_t*  pba
+       const cntx_t*     cntx,
+             pba_node_t* node
      );
 void bli_pba_finalize_pools
      (
-       pba_t* pba
+       pba_node_t* node
      );
 
 void bli_pba_compute_pool_block_sizes
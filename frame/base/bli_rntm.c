@@ -218,6 +218,16 @@ void bli_rntm_init_from_env
 	bli_rntm_set_pack_a( pack_a, rntm );
 	bli_rntm_set_pack_b( pack_b, rntm );
 
+	// ------------------------------------------------------------------------
+
+	// Try to read BLIS_JRIR_DYNAMIC, which requests that the threads sharing
+	// the jr and ir loops of the gemm macro-kernel claim microtiles from a
+	// shared counter rather than partitioning them statically. Anything
+	// other than an unset or zero value is interpreted as TRUE.
+	gint_t jrir_dyn_env = bli_env_get_var( "BLIS_JRIR_DYNAMIC", 0 );
+
+	bli_rntm_set_jrir_dyn( jrir_dyn_env != 0, rntm );
+
 #if 0
 	printf( "bli_pack_init_rntm_from_env()\n" );
 	bli_rntm_print( rntm );
@@ -289,7 +299,7 @@ void bli_rntm_set_ways
 
 	// Record the number of ways of parallelism per loop.
 	bli_rntm_set_jc_ways_only( jc, rntm );
-	bli_rntm_set_pc_ways_only(  1, rntm ); // Disable pc_nt values.
+	bli_rntm_set_pc_ways_only( pc, rntm );
 	bli_rntm_set_ic_ways_only( ic, rntm );
 	bli_rntm_set_jr_ways_only( jr, rntm );
 	bli_rntm_set_ir_ways_only( ir, rntm );
@@ -363,7 +373,7 @@ void bli_rntm_sanitize
 		// parallelism were set to meaningful values.
 		if ( nt > 1 ) { nt_set   = TRUE; }
 		if ( jc > 1 ) { ways_set = TRUE; }
-		if ( pc > 1 ) { ways_set = TRUE; pc = 1; } // Disable pc_nt values.
+		if ( pc > 1 ) { ways_set = TRUE; }
 		if ( ic > 1 ) { ways_set = TRUE; }
 		if ( jr > 1 ) { ways_set = TRUE; }
 		if ( ir > 1 ) { ways_set = TRUE; }
@@ -421,6 +431,64 @@ void bli_rntm_sanitize
 #endif
 }
 
+void bli_rntm_limit_num_threads
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   mr,
+       dim_t   nr,
+       rntm_t* rntm
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	// Only cap the number of threads when it is to be factorized
+	// automatically; explicitly requested ways of parallelism are honored
+	// as given.
+	if ( !bli_rntm_auto_factor( rntm ) ) return;
+
+	dim_t nt     = bli_rntm_num_threads( rntm );
+	dim_t nt_max = nt;
+
+	if ( m <= 0 || n <= 0 || k < 0 ) return;
+
+	// Give each thread at least BLIS_THREAD_MIN_FLOPS flops so that small
+	// problems are not dominated by the cost of launching and synchronizing
+	// threads.
+	if ( 0 < BLIS_THREAD_MIN_FLOPS )
+	{
+		double flops = 2.0 * ( double )m * ( double )n * ( double )k;
+		dim_t  nt_f  = ( dim_t )( flops / ( double )BLIS_THREAD_MIN_FLOPS );
+
+		nt_max = bli_min( nt_max, bli_max( nt_f, 1 ) );
+	}
+
+	// Give each thread at least BLIS_THREAD_MIN_TILES mr x nr microtiles of
+	// C, since the ic/ir and jc/jr loops cannot partition C more finely than
+	// that. Additional threads can only be put to use in the pc loop, and
+	// only as long as bli_rntm_factorize() would still be willing to
+	// parallelize it.
+	if ( 0 < BLIS_THREAD_MIN_TILES && 0 < mr && 0 < nr )
+	{
+		dim_t tiles = ( ( m + mr - 1 ) / mr ) * ( ( n + nr - 1 ) / nr );
+		dim_t nt_pc = bli_max( k / ( BLIS_THREAD_RATIO_K * bli_max( m, n ) ), 1 );
+		dim_t nt_t  = bli_max( tiles / BLIS_THREAD_MIN_TILES, 1 ) * nt_pc;
+
+		nt_max = bli_min( nt_max, nt_t );
+	}
+
+	if ( nt_max < nt )
+		bli_rntm_set_num_threads_only( nt_max, rntm );
+
+#else
+
+	// When multithreading is disabled at compile time, there is only ever
+	// one thread.
+
+#endif
+}
+
 void bli_rntm_factorize
      (
        dim_t   m,
@@ -458,8 +526,18 @@ void bli_rntm_factorize
 			//         (int)m, (int)n, (int)BLIS_THREAD_RATIO_M,
 			//                         (int)BLIS_THREAD_RATIO_N );
 
-			bli_thread_partition_2x2( nt, m*BLIS_THREAD_RATIO_M,
-			                              n*BLIS_THREAD_RATIO_N, &ic, &jc );
+			// If k dominates m and n, parallelize the pc loop using the
+			// largest factor of nt that leaves each group of threads at least
+			// BLIS_THREAD_RATIO_K * max(m,n) iterations of k. The remaining
+			// threads are then factorized over the ic and jc loops.
+			for ( pc = nt ; pc > 1 ; pc-- )
+			{
+				if ( nt % pc == 0 &&
+				     pc * BLIS_THREAD_RATIO_K * bli_max( m, n ) <= k ) break;
+			}
+
+			bli_thread_partition_2x2( nt / pc, m*BLIS_THREAD_RATIO_M,
+			                                   n*BLIS_THREAD_RATIO_N, &ic, &jc );
 
 			//printf( "jc ic = %d %d\n", (int)jc, (int)ic );
 
@@ -531,6 +609,21 @@ void bli_rntm_factorize_sup
 		bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
 	}
 
+	// The sup code path does not parallelize the pc loop, so fold any
+	// parallelism requested there into the ic loop.
+	if ( bli_rntm_pc_ways( rntm ) > 1 )
+	{
+		bli_rntm_set_ways_only
+		(
+		  bli_rntm_jc_ways( rntm ),
+		  1,
+		  bli_rntm_ic_ways( rntm ) * bli_rntm_pc_ways( rntm ),
+		  bli_rntm_jr_ways( rntm ),
+		  bli_rntm_ir_ways( rntm ),
+		  rntm
+		);
+	}
+
 #else
 
 	// When multithreading is disabled at compile time, the rntm can keep its
@@ -52,6 +52,10 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	bool      jrir_dyn;
+
+	const gemm_epilogue_t* epilogue;
+	const gemm_prologue_t* prologue;
 } rntm_t;
 */
 
@@ -129,6 +133,21 @@ BLIS_INLINE bool bli_rntm_l3_sup( const rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE bool bli_rntm_jrir_dyn( const rntm_t* rntm )
+{
+	return rntm->jrir_dyn;
+}
+
+BLIS_INLINE const gemm_epilogue_t* bli_rntm_epilogue( const rntm_t* rntm )
+{
+	return rntm->epilogue;
+}
+
+BLIS_INLINE const gemm_prologue_t* bli_rntm_prologue( const rntm_t* rntm )
+{
+	return rntm->prologue;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -159,7 +178,7 @@ BLIS_INLINE void bli_rntm_set_jc_ways_only( dim_t ways, rntm_t* rntm )
 }
 BLIS_INLINE void bli_rntm_set_pc_ways_only( dim_t ways, rntm_t* rntm )
 {
-	bli_rntm_set_ways_for_only( BLIS_KC, 1, rntm );
+	bli_rntm_set_ways_for_only( BLIS_KC, ways, rntm );
 }
 BLIS_INLINE void bli_rntm_set_ic_ways_only( dim_t ways, rntm_t* rntm )
 {
@@ -182,7 +201,7 @@ BLIS_INLINE void bli_rntm_set_ways_only( dim_t jc, dim_t pc, dim_t ic, dim_t jr,
 {
 	// Record the number of ways of parallelism per loop.
 	bli_rntm_set_jc_ways_only( jc, rntm );
-	bli_rntm_set_pc_ways_only(  1, rntm );
+	bli_rntm_set_pc_ways_only( pc, rntm );
 	bli_rntm_set_ic_ways_only( ic, rntm );
 	bli_rntm_set_jr_ways_only( jr, rntm );
 	bli_rntm_set_ir_ways_only( ir, rntm );
@@ -233,6 +252,35 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_jrir_dyn( bool jrir_dyn, rntm_t* rntm )
+{
+	// Set the bool indicating whether the threads sharing the jr and ir
+	// loops of the gemm macro-kernel claim microtiles dynamically.
+	rntm->jrir_dyn = jrir_dyn;
+}
+BLIS_INLINE void bli_rntm_enable_jrir_dyn( rntm_t* rntm )
+{
+	bli_rntm_set_jrir_dyn( TRUE, rntm );
+}
+BLIS_INLINE void bli_rntm_disable_jrir_dyn( rntm_t* rntm )
+{
+	bli_rntm_set_jrir_dyn( FALSE, rntm );
+}
+
+BLIS_INLINE void bli_rntm_set_epilogue( const gemm_epilogue_t* epilogue, rntm_t* rntm )
+{
+	// Set the epilogue (or NULL for none) to be fused into the write-back
+	// of C by bli_gemm_ex().
+	rntm->epilogue = epilogue;
+}
+
+BLIS_INLINE void bli_rntm_set_prologue( const gemm_prologue_t* prologue, rntm_t* rntm )
+{
+	// Set the prologue (or NULL for none) to be fused into the packing of
+	// A and B by bli_gemm_ex().
+	rntm->prologue = prologue;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -258,6 +306,18 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_jrir_dyn( rntm_t* rntm )
+{
+	bli_rntm_set_jrir_dyn( FALSE, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_epilogue( rntm_t* rntm )
+{
+	bli_rntm_set_epilogue( NULL, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_prologue( rntm_t* rntm )
+{
+	bli_rntm_set_prologue( NULL, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -278,6 +338,10 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           /* .pack_a      = */ FALSE, \
           /* .pack_b      = */ FALSE, \
           /* .l3_sup      = */ TRUE, \
+          /* .jrir_dyn    = */ FALSE, \
+\
+          /* .epilogue    = */ NULL, \
+          /* .prologue    = */ NULL, \
         }  \
 
 #if 0
@@ -292,6 +356,9 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_jrir_dyn( rntm );
+	bli_rntm_clear_epilogue( rntm );
+	bli_rntm_clear_prologue( rntm );
 }
 #endif
 
@@ -351,6 +418,16 @@ void bli_rntm_sanitize
        rntm_t* rntm
      );
 
+BLIS_EXPORT_BLIS void bli_rntm_limit_num_threads
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   mr,
+       dim_t   nr,
+       rntm_t* rntm
+     );
+
 BLIS_EXPORT_BLIS void bli_rntm_factorize
      (
        dim_t   m,
@@ -169,6 +169,9 @@ void bli_dt_string_check( num_t dt )
 {
 	err_t e_val;
 
+	e_val = bli_check_valid_datatype( dt );
+	bli_check_error_code( e_val );
+
 	e_val = bli_check_nonconstant_datatype( dt );
 	bli_check_error_code( e_val );
 }
@@ -74,14 +74,14 @@ void PASTEF77(ch,blasname) \
 		( \
 		  MKSTR(ch), \
 		  MKSTR(blisname), \
-		  transa_array+gi, \
-		  transb_array+gi, \
-		  m_array+gi, \
-		  n_array+gi, \
-		  k_array+gi, \
-		  lda_array+gi, \
-		  ldb_array+gi, \
-		  ldc_array+gi \
+		  &transa_array[gi], \
+		  &transb_array[gi], \
+		  &m_array[gi], \
+		  &n_array[gi], \
+		  &k_array[gi], \
+		  &lda_array[gi], \
+		  &ldb_array[gi], \
+		  &ldc_array[gi] \
 		); \
 	} \
 \
@@ -134,6 +134,94 @@ void PASTEF77(ch,blasname) \
 
 #else
 
+#ifdef BLIS_ENABLE_BLAS
+
+// The parameters needed to describe every member of a batch of problems
+// given in the grouped, pointer-array format of ?gemm_batch_().
+typedef struct bla_gemm_batch_params_s
+{
+	      num_t     dt;
+	      f77_int   group_count;
+	      dim_t*    group_off;
+	const f77_char* transa_array;
+	const f77_char* transb_array;
+	const f77_int*  m_array;
+	const f77_int*  n_array;
+	const f77_int*  k_array;
+	const void*     alpha_array;
+	const void**    a_array; const f77_int* lda_array;
+	const void**    b_array; const f77_int* ldb_array;
+	const void*     beta_array;
+	      void**    c_array; const f77_int* ldc_array;
+} bla_gemm_batch_params_t;
+
+static void bla_gemm_batch_prob
+     (
+             dim_t  idx,
+       const void*  params_void,
+             obj_t* alphao,
+             obj_t* ao,
+             obj_t* bo,
+             obj_t* betao,
+             obj_t* co
+     )
+{
+	const bla_gemm_batch_params_t* params = params_void;
+
+	const num_t dt      = params->dt;
+	const siz_t dt_size = bli_dt_size( dt );
+
+	// Find the group i to which problem idx belongs via binary search of
+	// the group offsets.
+	f77_int lo = 0;
+	f77_int hi = params->group_count - 1;
+	while ( lo < hi )
+	{
+		f77_int mid = ( lo + hi + 1 ) / 2;
+		if ( params->group_off[ mid ] <= idx ) lo = mid;
+		else                                   hi = mid - 1;
+	}
+	const f77_int i = lo;
+
+	trans_t blis_transa;
+	trans_t blis_transb;
+	dim_t   m0, n0, k0;
+
+	/* Map BLAS chars to their corresponding BLIS enumerated type value. */
+	bli_param_map_netlib_to_blis_trans( params->transa_array[i], &blis_transa );
+	bli_param_map_netlib_to_blis_trans( params->transb_array[i], &blis_transb );
+
+	/* Typecast BLAS integers to BLIS integers. */
+	bli_convert_blas_dim1( params->m_array[i], m0 );
+	bli_convert_blas_dim1( params->n_array[i], n0 );
+	bli_convert_blas_dim1( params->k_array[i], k0 );
+
+	/* Set the row and column strides of the matrix operands. */
+	const inc_t rs_a = 1;
+	const inc_t cs_a = params->lda_array[i];
+	const inc_t rs_b = 1;
+	const inc_t cs_b = params->ldb_array[i];
+	const inc_t rs_c = 1;
+	const inc_t cs_c = params->ldc_array[i];
+
+	dim_t       m0_a, n0_a;
+	dim_t       m0_b, n0_b;
+
+	bli_set_dims_with_trans( blis_transa, m0, k0, &m0_a, &n0_a );
+	bli_set_dims_with_trans( blis_transb, k0, n0, &m0_b, &n0_b );
+
+	bli_obj_init_finish_1x1( dt, ( char* )params->alpha_array + i*dt_size, alphao );
+	bli_obj_init_finish_1x1( dt, ( char* )params->beta_array  + i*dt_size, betao );
+
+	bli_obj_init_finish( dt, m0_a, n0_a, ( void* )params->a_array[idx], rs_a, cs_a, ao );
+	bli_obj_init_finish( dt, m0_b, n0_b, ( void* )params->b_array[idx], rs_b, cs_b, bo );
+	bli_obj_init_finish( dt, m0,   n0,   ( void* )params->c_array[idx], rs_c, cs_c, co );
+	bli_obj_set_conjtrans( blis_transa, ao );
+	bli_obj_set_conjtrans( blis_transb, bo );
+}
+
+#endif
+
 #undef  GENTFUNC
 #define GENTFUNC( ftype, ch, blasname, blisname ) \
 \
@@ -152,10 +240,6 @@ void PASTEF77(ch,blasname) \
        const f77_int* group_count, \
        const f77_int* group_size ) \
 { \
-	trans_t blis_transa; \
-	trans_t blis_transb; \
-	dim_t   m0, n0, k0; \
-\
 	/* Initialize BLIS. */ \
 	bli_init_auto(); \
 \
@@ -166,78 +250,62 @@ void PASTEF77(ch,blasname) \
 		( \
 		  MKSTR(ch), \
 		  MKSTR(blisname), \
-		  transa_array+gi, \
-		  transb_array+gi, \
-		  m_array+gi, \
-		  n_array+gi, \
-		  k_array+gi, \
-		  lda_array+gi, \
-		  ldb_array+gi, \
-		  ldc_array+gi \
+		  &transa_array[gi], \
+		  &transb_array[gi], \
+		  &m_array[gi], \
+		  &n_array[gi], \
+		  &k_array[gi], \
+		  &lda_array[gi], \
+		  &ldb_array[gi], \
+		  &ldc_array[gi] \
 		); \
 	} \
 \
-	const num_t dt     = PASTEMAC(ch,type); \
-\
-	f77_int idx = 0, i, j; \
-\
-	for ( i = 0; i < *group_count; i++ ) \
+	/* Quick return if there are no groups. */ \
+	if ( *group_count <= 0 ) \
 	{ \
-		/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
-		bli_param_map_netlib_to_blis_trans( transa_array[i], &blis_transa ); \
-		bli_param_map_netlib_to_blis_trans( transb_array[i], &blis_transb ); \
-\
-		/* Typecast BLAS integers to BLIS integers. */ \
-		bli_convert_blas_dim1( m_array[i], m0 ); \
-		bli_convert_blas_dim1( n_array[i], n0 ); \
-		bli_convert_blas_dim1( k_array[i], k0 ); \
-\
-		/* Set the row and column strides of the matrix operands. */ \
-		const inc_t rs_a = 1; \
-		const inc_t cs_a = lda_array[i]; \
-		const inc_t rs_b = 1; \
-		const inc_t cs_b = ldb_array[i]; \
-		const inc_t rs_c = 1; \
-		const inc_t cs_c = ldc_array[i]; \
-\
-		obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
-		obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+		bli_finalize_auto(); \
+		return; \
+	} \
 \
-		dim_t       m0_a, n0_a; \
-		dim_t       m0_b, n0_b; \
+	/* Record the index of the first problem of each group so that the
+	   problems may be addressed by a single index. */ \
+	err_t  r_val; \
+	dim_t* group_off = bli_malloc_intl( sizeof( dim_t ) * ( *group_count + 1 ), &r_val ); \
 \
-		bli_set_dims_with_trans( blis_transa, m0, k0, &m0_a, &n0_a ); \
-		bli_set_dims_with_trans( blis_transb, k0, n0, &m0_b, &n0_b ); \
+	group_off[0] = 0; \
+	for ( f77_int i = 0; i < *group_count; i++ ) \
+		group_off[i+1] = group_off[i] + bli_max( group_size[i], 0 ); \
 \
-		bli_obj_init_finish_1x1( dt, (ftype*)(alpha_array + i), &alphao ); \
-		bli_obj_init_finish_1x1( dt, (ftype*)(beta_array  + i),  &betao ); \
+	bla_gemm_batch_params_t params; \
+	params.dt           = PASTEMAC(ch,type); \
+	params.group_count  = *group_count; \
+	params.group_off    = group_off; \
+	params.transa_array = transa_array; \
+	params.transb_array = transb_array; \
+	params.m_array      = m_array; \
+	params.n_array      = n_array; \
+	params.k_array      = k_array; \
+	params.alpha_array  = alpha_array; \
+	params.a_array      = ( const void** )a_array; \
+	params.lda_array    = lda_array; \
+	params.b_array      = ( const void** )b_array; \
+	params.ldb_array    = ldb_array; \
+	params.beta_array   = beta_array; \
+	params.c_array      = ( void** )c_array; \
+	params.ldc_array    = ldc_array; \
 \
-		for( j = 0; j < group_size[i]; j++ ) \
-		{ \
-			obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
-			obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
-			obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+	/* Distribute the problems across the threads. */ \
+	bli_l3_batch_thread_decorator \
+	( \
+	  group_off[ *group_count ], \
+	  bla_gemm_batch_prob, \
+	  &params, \
+	  NULL, \
+	  NULL  \
+	); \
 \
-			bli_obj_init_finish( dt, m0_a, n0_a, (ftype*)*(a_array + idx), rs_a, cs_a, &ao ); \
-			bli_obj_init_finish( dt, m0_b, n0_b, (ftype*)*(b_array + idx), rs_b, cs_b, &bo ); \
-			bli_obj_init_finish( dt, m0,   n0,   (ftype*)*(c_array + idx), rs_c, cs_c, &co ); \
-			bli_obj_set_conjtrans( blis_transa, &ao ); \
-			bli_obj_set_conjtrans( blis_transb, &bo ); \
-\
-			PASTEMAC(blisname,BLIS_OAPI_EX_SUF) \
-			( \
-			  &alphao, \
-			  &ao, \
-			  &bo, \
-			  &betao, \
-			  &co, \
-			  NULL, \
-			  NULL  \
-			); \
-\
-			idx++; \
-		} \
-	} \
+	bli_free_intl( group_off ); \
 \
 	/* Finalize BLIS. */  \
 	bli_finalize_auto(); \
@@ -38,63 +38,145 @@
 
 // -- Typecast { bfloat16 | float | double } to bfloat16 -----------------------
 
-#ifdef BFLOAT
 BLIS_INLINE bfloat bli_bbcast( bfloat b )
 {
 	return b;
 }
-#endif
 
-#ifdef BFLOAT
 BLIS_INLINE bfloat bli_sbcast( float s )
 {
-	bfloat b;
+	bfloat   b;
+	uint32_t u;
 
-	// View the float as a char array.
-	char* s_ch = ( char* )&s;
+	// View the float as its bit pattern.
+	memcpy( &u, &s, sizeof( u ) );
 
-	// Copy upper two bytes of float to a local bfloat16.
-	memcpy( &b, &s_ch[2], 2 );
+	// Keep NaNs quiet (truncation could otherwise turn a NaN into an
+	// infinity) and round everything else to nearest-even before keeping
+	// the upper two bytes.
+	if ( ( u & 0x7fffffffu ) > 0x7f800000u )
+		b.bits = ( uint16_t )( ( u >> 16 ) | 0x0040u );
+	else
+		b.bits = ( uint16_t )( ( u + 0x7fffu + ( ( u >> 16 ) & 1u ) ) >> 16 );
 
 	return b;
 }
-#endif
 
-#ifdef BFLOAT
 BLIS_INLINE bfloat bli_dbcast( double d )
 {
-	bfloat b;
+	return bli_sbcast( ( float )d );
+}
 
-	// Typecast double input argument to a local float.
-	float s = ( float )d;
+// -- Typecast { float16 | float | double } to float16 -------------------------
 
-	// View the float as a char array.
-	char* s_ch = ( char* )&s;
+BLIS_INLINE hfloat bli_hhcast( hfloat h )
+{
+	return h;
+}
 
-	// Copy upper two bytes of float to a local bfloat16.
-	memcpy( &b, &s_ch[2], 2 );
+BLIS_INLINE hfloat bli_shcast( float s )
+{
+	hfloat   h;
+	uint32_t u;
 
-	return b;
+	memcpy( &u, &s, sizeof( u ) );
+
+	const uint32_t sign = ( u >> 16 ) & 0x8000u;
+	const uint32_t absu = u & 0x7fffffffu;
+
+	if ( absu >= 0x7f800000u )
+	{
+		// Infinity or NaN (keeping NaNs quiet).
+		h.bits = ( uint16_t )( sign | 0x7c00u | ( absu > 0x7f800000u ? 0x0200u : 0u ) );
+	}
+	else if ( absu >= 0x477ff000u )
+	{
+		// Values of 65520 or greater round to infinity.
+		h.bits = ( uint16_t )( sign | 0x7c00u );
+	}
+	else if ( absu >= 0x38800000u )
+	{
+		// Normal float16 range: rebias the exponent and round the mantissa
+		// to nearest-even. A carry out of the mantissa correctly bumps the
+		// exponent.
+		uint32_t r = ( absu - 0x38000000u ) >> 13;
+		uint32_t t = absu & 0x1fffu;
+		if ( t > 0x1000u || ( t == 0x1000u && ( r & 1u ) ) ) r += 1;
+		h.bits = ( uint16_t )( sign | r );
+	}
+	else if ( absu >= 0x33000000u )
+	{
+		// Subnormal float16 range.
+		uint32_t e     = absu >> 23;
+		uint32_t m     = ( absu & 0x7fffffu ) | 0x800000u;
+		uint32_t shift = 126 - e;
+		uint32_t r     = m >> shift;
+		uint32_t t     = m & ( ( 1u << shift ) - 1 );
+		uint32_t half  = 1u << ( shift - 1 );
+		if ( t > half || ( t == half && ( r & 1u ) ) ) r += 1;
+		h.bits = ( uint16_t )( sign | r );
+	}
+	else
+	{
+		// Underflow to (signed) zero.
+		h.bits = ( uint16_t )sign;
+	}
+
+	return h;
 }
-#endif
 
-// -- Typecast { bfloat16 | float | double | int } to float --------------------------
+BLIS_INLINE hfloat bli_dhcast( double d )
+{
+	return bli_shcast( ( float )d );
+}
+
+// -- Typecast { bfloat16 | float16 | float | double | int } to float ----------
 
-#ifdef BFLOAT
 BLIS_INLINE float bli_bscast( bfloat b )
 {
-	// Initialize all bits in a local float to zero.
-	float s = 0.0F;
+	float    s;
+	uint32_t u = ( uint32_t )b.bits << 16;
+
+	// The bfloat16 value forms the upper two bytes of the float.
+	memcpy( &s, &u, sizeof( s ) );
+
+	return s;
+}
+
+BLIS_INLINE float bli_hscast( hfloat h )
+{
+	float    s;
+	uint32_t sign = ( ( uint32_t )h.bits & 0x8000u ) << 16;
+	uint32_t e    = ( h.bits >> 10 ) & 0x1fu;
+	uint32_t m    = h.bits & 0x3ffu;
+	uint32_t u;
 
-	// View the float as a char array.
-	char* s_ch = ( char* )&s;
+	if ( e == 0x1f )
+	{
+		// Infinity or NaN.
+		u = sign | 0x7f800000u | ( m << 13 );
+	}
+	else if ( e != 0 )
+	{
+		// Normal value: rebias the exponent.
+		u = sign | ( ( e + 112 ) << 23 ) | ( m << 13 );
+	}
+	else if ( m != 0 )
+	{
+		// Subnormal float16 values are normal floats.
+		e = 113;
+		while ( ( m & 0x400u ) == 0 ) { m <<= 1; e -= 1; }
+		u = sign | ( e << 23 ) | ( ( m & 0x3ffu ) << 13 );
+	}
+	else
+	{
+		u = sign;
+	}
 
-	// Copy bfloat16 to the upper two bytes of a local float.
-	memcpy( &s_ch[2], &b, 2 );
+	memcpy( &s, &u, sizeof( s ) );
 
 	return s;
 }
-#endif
 
 BLIS_INLINE float bli_sscast( float s )
 {
@@ -111,23 +193,17 @@ BLIS_INLINE float bli_iscast( dim_t i )
 	return ( float )i;
 }
 
-// -- Typecast { bfloat16 | float | double | int } to double -------------------------
+// -- Typecast { bfloat16 | float16 | float | double | int } to double ---------
 
-#ifdef BFLOAT
 BLIS_INLINE double bli_bdcast( bfloat b )
 {
-	// Initialize all bits in a local float to zero.
-	float s = 0.0F;
-
-	// View the float as a char array.
-	char* s_ch = ( char* )&s;
-
-	// Copy bfloat16 to the upper two bytes of a local float.
-	memcpy( &s_ch[2], &b, 2 );
+	return ( double )bli_bscast( b );
+}
 
-	return ( double )s;
+BLIS_INLINE double bli_hdcast( hfloat h )
+{
+	return ( double )bli_hscast( h );
 }
-#endif
 
 BLIS_INLINE double bli_sdcast( float s )
 {
@@ -232,7 +308,12 @@ GENTFUNC( z, d )
 #define bli_cbtcast  bli_cbcast
 #define bli_zbtcast  bli_zbcast
 
+#define bli_hhtcast  bli_hhcast
+#define bli_shtcast  bli_shcast
+#define bli_dhtcast  bli_dhcast
+
 #define bli_bstcast  bli_bscast
+#define bli_hstcast  bli_hscast
 #define bli_sstcast  bli_sscast
 #define bli_dstcast  bli_dscast
 #define bli_kstcast  bli_kscast
@@ -241,6 +322,7 @@ GENTFUNC( z, d )
 #define bli_istcast  bli_iscast
 
 #define bli_bdtcast  bli_bdcast
+#define bli_hdtcast  bli_hdcast
 #define bli_sdtcast  bli_sdcast
 #define bli_ddtcast  bli_ddcast
 #define bli_kdtcast  bli_kdcast
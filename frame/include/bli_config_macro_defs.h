@@ -84,6 +84,35 @@
 #define BLIS_CACHE_LINE_SIZE 64
 #endif
 
+// The maximum number of NUMA nodes for which the packing block allocator
+// maintains separate memory pools. Threads running on nodes beyond this
+// limit share pools with lower-numbered nodes. Setting this to 1 disables
+// NUMA-aware pools.
+#ifndef BLIS_NUMA_MAX_NODES
+#define BLIS_NUMA_MAX_NODES 8
+#endif
+
+// The number of slots (per pool, per NUMA node) in the lock-free cache of
+// packing blocks that sits in front of the pools of the packing block
+// allocator. Each application thread is assigned one slot, which it uses
+// to return a block and then check it out again without acquiring a lock.
+#ifndef BLIS_PBA_CACHE_SLOTS
+#define BLIS_PBA_CACHE_SLOTS 16
+#endif
+
+// The size of the huge pages used to back the memory pools of the packing
+// block allocator when huge pages are enabled (e.g. via the BLIS_HUGE_PAGES
+// environment variable).
+#ifndef BLIS_HUGE_PAGE_SIZE
+#define BLIS_HUGE_PAGE_SIZE (2*1024*1024)
+#endif
+
+// Whether the packing block allocator backs its memory pools with huge
+// pages by default. This may be overridden at runtime.
+#ifndef BLIS_HUGE_PAGES_DEFAULT
+#define BLIS_HUGE_PAGES_DEFAULT 0
+#endif
+
 
 // -- MULTITHREADING -----------------------------------------------------------
 
@@ -149,6 +178,21 @@
   #define BLIS_NT_MAX_PRIME 11
 #endif
 
+// Set the minimum number of matrix elements that each thread must be assigned
+// before a level-2 operation (e.g. gemv, ger, hemv/symv, trmv) is executed in
+// parallel. The number of threads requested via the rntm_t is capped so that
+// no thread receives fewer elements than this.
+// Set the minimum number of vector elements that each thread must be assigned
+// before a level-1v operation (e.g. axpyv, copyv, dotv, scalv) or a vector
+// reduction (e.g. asumv, normfv) is executed in parallel.
+#ifndef BLIS_L1V_MT_MIN_ELEMS
+  #define BLIS_L1V_MT_MIN_ELEMS 65536
+#endif
+
+#ifndef BLIS_L2_MT_MIN_ELEMS
+  #define BLIS_L2_MT_MIN_ELEMS 65536
+#endif
+
 
 // -- MISCELLANEOUS OPTIONS ----------------------------------------------------
 
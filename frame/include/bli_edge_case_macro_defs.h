@@ -109,6 +109,28 @@
 	                     ( ( ( row_major ? _rs_c : _cs_c )*sizeof( PASTEMAC(ch,ctype) ) ) % alignment ); \
 	GEMM_UKR_SETUP_CT_POST(ch);
 
+#define GEMM_UKR_SETUP_CT_MASKED(ch,mr,nr,row_major) \
+\
+	/* Scenario 5: Similar to (1), but the ukernel also handles edge cases
+	   (m < mr or n < nr) in place, e.g. via masked loads and stores. Use a
+	   temporary microtile only for the non-preferred IO cases. */ \
+	GEMM_UKR_SETUP_CT_PRE(ch,mr,nr,row_major,1); \
+	const bool _use_ct = ( row_major ? cs_c != 1 : rs_c != 1 ); \
+	GEMM_UKR_SETUP_CT_POST(ch);
+
+#define GEMM_UKR_SETUP_CT_AMBI_MASKED(ch,mr,nr,row_major) \
+\
+	/* Scenario 6: Similar to (2), but the ukernel also handles edge cases
+	   in place when C is stored according to its IO preference. Use a
+	   temporary microtile for the general stride case as well as edge
+	   cases with the opposite IO. */ \
+	GEMM_UKR_SETUP_CT_PRE(ch,mr,nr,row_major,1); \
+	const bool _use_ct = ( cs_c != 1 && rs_c != 1 ) || \
+	                     ( ( m != mr || n != nr ) && \
+	                       ( row_major ? cs_c != 1 || rs_c == 1 \
+	                                   : rs_c != 1 || cs_c == 1 ) ); \
+	GEMM_UKR_SETUP_CT_POST(ch);
+
 // -- Flush macros --
 
 #define GEMM_UKR_FLUSH_CT(ch) \
@@ -269,6 +269,21 @@ GENTFUNC2( dcomplex, scomplex, z, c, __VA_ARGS__ )
 
 
 
+// -- Half-precision input two-operand macro --
+
+// NOTE: Only the real computation datatypes are used as outputs since
+// bfloat16 and float16 values are real.
+
+#define INSERT_GENTFUNC2_HALF( ... ) \
+\
+GENTFUNC2( bfloat,   float,    b, s, __VA_ARGS__ ) \
+GENTFUNC2( bfloat,   double,   b, d, __VA_ARGS__ ) \
+\
+GENTFUNC2( hfloat,   float,    h, s, __VA_ARGS__ ) \
+GENTFUNC2( hfloat,   double,   h, d, __VA_ARGS__ )
+
+
+
 // -- Mixed domain/precision (all) two-operand macro --
 
 #define INSERT_GENTFUNC2_MIX_DP( ... ) \
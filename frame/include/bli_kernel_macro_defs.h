@@ -52,6 +52,29 @@
 #define BLIS_THREAD_RATIO_N     1
 #endif
 
+// This BLIS_THREAD_RATIO_K macro sets how much larger k must be than the
+// larger of m and n, per way of parallelism, before automatic factorization
+// parallelizes the pc loop (with a reduction over the partial products of
+// C). See bli_rntm.c to see how this macro is used.
+#ifndef BLIS_THREAD_RATIO_K
+#define BLIS_THREAD_RATIO_K     16
+#endif
+
+// These BLIS_THREAD_MIN_? macros cap the number of threads used when the
+// total number of threads is factorized automatically, so that small
+// problems do not pay for more threads than they can keep busy: each thread
+// must receive at least BLIS_THREAD_MIN_FLOPS flops and at least
+// BLIS_THREAD_MIN_TILES register-blocked microtiles of C (times the number
+// of ways the pc loop could be parallelized). A value of zero disables the
+// corresponding cap. See bli_rntm_limit_num_threads() in bli_rntm.c.
+#ifndef BLIS_THREAD_MIN_FLOPS
+#define BLIS_THREAD_MIN_FLOPS   500000
+#endif
+
+#ifndef BLIS_THREAD_MIN_TILES
+#define BLIS_THREAD_MIN_TILES   8
+#endif
+
 // These BLIS_THREAD_MAX_?R macros place a ceiling on the maximum amount of
 // parallelism allowed when performing automatic factorization. See bli_rntm.c
 // to see how these macros are used.
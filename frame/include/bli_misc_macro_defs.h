@@ -128,6 +128,8 @@ BLIS_INLINE void bli_toggle_bool( bool* b )
 #define bli_dtype ( BLIS_DOUBLE   )
 #define bli_ctype ( BLIS_SCOMPLEX )
 #define bli_ztype ( BLIS_DCOMPLEX )
+#define bli_btype ( BLIS_BFLOAT   )
+#define bli_htype ( BLIS_HFLOAT   )
 
 // return C type for datatype char
 
@@ -135,6 +137,8 @@ BLIS_INLINE void bli_toggle_bool( bool* b )
 #define bli_dctype  double
 #define bli_cctype  scomplex
 #define bli_zctype  dcomplex
+#define bli_bctype  bfloat
+#define bli_hctype  hfloat
 
 // return C type for domain and precision chars
 
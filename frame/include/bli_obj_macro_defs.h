@@ -306,6 +306,12 @@ BLIS_INLINE bool bli_obj_is_panel_packed( const obj_t* obj )
 	       ( obj->info & BLIS_PACK_PANEL_BIT );
 }
 
+BLIS_INLINE bool bli_obj_is_sup_packed( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_pack_schema( obj ) == BLIS_PACKED_PANELS_SUP );
+}
+
 BLIS_INLINE packbuf_t bli_obj_pack_buffer_type( const obj_t* obj )
 {
 	return ( packbuf_t )
@@ -342,6 +348,14 @@ BLIS_INLINE bool bli_obj_is_triangular( const obj_t* obj )
 	       ( bli_obj_struc( obj ) == BLIS_BITVAL_TRIANGULAR );
 }
 
+// NOTE: This bit is set on C while it holds only a partial sum over the k
+// dimension (ie: for all but the last rank-k update of the pc loop).
+BLIS_INLINE bool bli_obj_is_partial_k( const obj_t* obj )
+{
+	return ( bool )
+	       ( obj->info & BLIS_PARTIAL_K_BIT );
+}
+
 // Info modification
 
 BLIS_INLINE void bli_obj_apply_trans( trans_t trans, obj_t* obj )
@@ -463,6 +477,13 @@ BLIS_INLINE void bli_obj_set_struc( struc_t struc, obj_t* obj )
 	            ( ( obj->info & ~BLIS_STRUC_BITS ) | struc );
 }
 
+BLIS_INLINE void bli_obj_set_partial_k( bool partial_k, obj_t* obj )
+{
+	obj->info = ( objbits_t )
+	            ( ( obj->info & ~BLIS_PARTIAL_K_BIT ) |
+	              ( partial_k ? BLIS_PARTIAL_K_BIT : 0 ) );
+}
+
 BLIS_INLINE void bli_obj_toggle_trans( obj_t* obj )
 {
 	bli_obj_apply_trans( BLIS_TRANSPOSE, obj );
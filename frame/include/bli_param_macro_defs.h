@@ -98,6 +98,25 @@ BLIS_INLINE bool bli_is_int( num_t dt )
 	       ( dt == BLIS_INT );
 }
 
+BLIS_INLINE bool bli_is_bfloat( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_BFLOAT );
+}
+
+BLIS_INLINE bool bli_is_hfloat( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_HFLOAT );
+}
+
+BLIS_INLINE bool bli_is_half_prec( num_t dt )
+{
+	return ( bool )
+	       ( bli_is_bfloat( dt ) ||
+	                   bli_is_hfloat( dt ) );
+}
+
 BLIS_INLINE bool bli_is_real( num_t dt )
 {
 	return ( bool )
@@ -130,6 +130,24 @@ typedef uint32_t objbits_t;  // object information bit field
 #define BLIS_SIZEOF_D      8  // sizeof(double)
 #define BLIS_SIZEOF_C      8  // sizeof(scomplex)
 #define BLIS_SIZEOF_Z      16 // sizeof(dcomplex)
+#define BLIS_SIZEOF_B      2  // sizeof(bfloat)
+#define BLIS_SIZEOF_H      2  // sizeof(hfloat)
+
+// -- Half-precision types --
+
+// Storage-only types for bfloat16 and IEEE float16 values. BLIS never
+// computes in these precisions directly; elements are widened (to float or
+// double) when they are packed, and so a plain bit container suffices and
+// keeps the types independent of compiler support for __bf16/_Float16.
+typedef struct bfloat
+{
+	uint16_t bits;
+} bfloat;
+
+typedef struct hfloat
+{
+	uint16_t bits;
+} hfloat;
 
 // -- Complex types --
 
@@ -256,7 +274,7 @@ typedef void  (*free_ft)  ( void*  p    );
 
 #define BLIS_DATATYPE_NUM_BITS             ( BLIS_DOMAIN_NUM_BITS + BLIS_PRECISION_NUM_BITS )
 #define   BLIS_DOMAIN_NUM_BITS               1
-#define   BLIS_PRECISION_NUM_BITS            2
+#define   BLIS_PRECISION_NUM_BITS            3
 #define BLIS_CONJTRANS_NUM_BITS            ( BLIS_TRANS_NUM_BITS + BLIS_CONJ_NUM_BITS )
 #define   BLIS_TRANS_NUM_BITS                1
 #define   BLIS_CONJ_NUM_BITS                 1
@@ -274,6 +292,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_PACK_REV_IF_LOWER_NUM_BITS    1
 #define BLIS_PACK_BUFFER_NUM_BITS          2
 #define BLIS_STRUC_NUM_BITS                2
+#define BLIS_PARTIAL_K_NUM_BITS            1
 
 
 //
@@ -304,8 +323,9 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_SCALAR_DT_SHIFT             ( BLIS_COMP_PREC_SHIFT + BLIS_PRECISION_NUM_BITS )
 #define   BLIS_SCALAR_DOMAIN_SHIFT       (   BLIS_SCALAR_DT_SHIFT )
 #define   BLIS_SCALAR_PREC_SHIFT         (   BLIS_SCALAR_DOMAIN_SHIFT + BLIS_DOMAIN_NUM_BITS )
+#define BLIS_PARTIAL_K_SHIFT             ( BLIS_SCALAR_DT_SHIFT + BLIS_DATATYPE_NUM_BITS )
 // This is the total number of bits, which should always be <= 32
-#define BLIS_INFO_NUM_BITS               ( BLIS_SCALAR_DT_SHIFT + BLIS_DATATYPE_NUM_BITS )
+#define BLIS_INFO_NUM_BITS               ( BLIS_PARTIAL_K_SHIFT + BLIS_PARTIAL_K_NUM_BITS )
 
 //
 // -- BLIS info bit field masks ------------------------------------------------
@@ -335,6 +355,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_SCALAR_DT_BITS                ( ( ( 1 << BLIS_DATATYPE_NUM_BITS          ) - 1 ) << BLIS_SCALAR_DT_SHIFT )
 #define   BLIS_SCALAR_DOMAIN_BIT           ( ( ( 1 << BLIS_DOMAIN_NUM_BITS            ) - 1 ) << BLIS_SCALAR_DOMAIN_SHIFT )
 #define   BLIS_SCALAR_PREC_BIT             ( ( ( 1 << BLIS_PRECISION_NUM_BITS         ) - 1 ) << BLIS_SCALAR_PREC_SHIFT )
+#define BLIS_PARTIAL_K_BIT                 ( ( ( 1 << BLIS_PARTIAL_K_NUM_BITS         ) - 1 ) << BLIS_PARTIAL_K_SHIFT )
 
 
 //
@@ -351,6 +372,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_DCOMPLEX_TYPE     ( BLIS_DOMAIN_BIT | BLIS_BITVAL_DOUBLE_PREC )
 #define   BLIS_BITVAL_INT_TYPE            0x04
 #define   BLIS_BITVAL_CONST_TYPE          0x05
+#define   BLIS_BITVAL_BFLOAT_TYPE         0x06
+#define   BLIS_BITVAL_HFLOAT_TYPE         0x08
 #define BLIS_BITVAL_NO_TRANS              0x0
 #define BLIS_BITVAL_TRANS                 BLIS_TRANS_BIT
 #define BLIS_BITVAL_NO_CONJ               0x0
@@ -367,11 +390,13 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_1E                ( 0x1  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_1R                ( 0x2  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_RO                ( 0x3  << BLIS_PACK_FORMAT_SHIFT )
+#define   BLIS_BITVAL_SUP               ( 0x4  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_PACKED_UNSPEC     ( BLIS_PACK_BIT                                         )
 #define   BLIS_BITVAL_PACKED_PANELS     ( BLIS_PACK_BIT                   | BLIS_PACK_PANEL_BIT )
 #define   BLIS_BITVAL_PACKED_PANELS_1E  ( BLIS_PACK_BIT | BLIS_BITVAL_1E  | BLIS_PACK_PANEL_BIT )
 #define   BLIS_BITVAL_PACKED_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT )
 #define   BLIS_BITVAL_PACKED_PANELS_RO  ( BLIS_PACK_BIT | BLIS_BITVAL_RO  | BLIS_PACK_PANEL_BIT )
+#define   BLIS_BITVAL_PACKED_PANELS_SUP ( BLIS_PACK_BIT | BLIS_BITVAL_SUP | BLIS_PACK_PANEL_BIT )
 #define BLIS_BITVAL_PACK_FWD_IF_UPPER     0x0
 #define BLIS_BITVAL_PACK_REV_IF_UPPER     BLIS_PACK_REV_IF_UPPER_BIT
 #define BLIS_BITVAL_PACK_FWD_IF_LOWER     0x0
@@ -451,6 +476,8 @@ typedef enum num_e
 	BLIS_DCOMPLEX          = BLIS_BITVAL_DCOMPLEX_TYPE,
 	BLIS_INT               = BLIS_BITVAL_INT_TYPE,
 	BLIS_CONSTANT          = BLIS_BITVAL_CONST_TYPE,
+	BLIS_BFLOAT            = BLIS_BITVAL_BFLOAT_TYPE,
+	BLIS_HFLOAT            = BLIS_BITVAL_HFLOAT_TYPE,
 	BLIS_DT_LO             = BLIS_FLOAT,
 	BLIS_DT_HI             = BLIS_DCOMPLEX
 } num_t;
@@ -480,6 +507,7 @@ typedef enum pack_e
 	BLIS_PACKED_PANELS_1E = BLIS_BITVAL_PACKED_PANELS_1E,
 	BLIS_PACKED_PANELS_1R = BLIS_BITVAL_PACKED_PANELS_1R,
 	BLIS_PACKED_PANELS_RO = BLIS_BITVAL_PACKED_PANELS_RO,
+	BLIS_PACKED_PANELS_SUP = BLIS_BITVAL_PACKED_PANELS_SUP,
 
 	// BLIS_NUM_PACK_SCHEMA_TYPES must be last!
 	// We start with BLIS_PACKED_PANELS.
@@ -684,6 +712,15 @@ typedef enum ukr_e
 	BLIS_GEMMSUP_CCC_UKR,
 	BLIS_GEMMSUP_XXX_UKR,
 
+	// int8 gemm kernels
+	BLIS_I8GEMM_UKR,
+
+	// gemm epilogue kernels
+	BLIS_GEMM_EPILOGUE_UKR,
+
+	// gemm micro-kernel with the opposite storage preference for C
+	BLIS_GEMM_ALT_UKR,
+
 	// BLIS_NUM_UKRS must after all 1-type kernels and before 2-type kernels!
 	BLIS_NUM_UKRS_, BLIS_NUM_UKRS = bli_ker_idx( BLIS_NUM_UKRS_ ),
 
@@ -718,6 +755,11 @@ typedef enum ukr_e
 	BLIS_UKRS_END_ = BLIS_VA_END
 } ukr_t;
 
+// The int8 gemm micro-kernel and its block sizes are not parameterized by
+// a num_t, so the context stores them in the slots of the floating-point
+// datatype whose size matches that of their int32 accumulators.
+#define BLIS_I8GEMM_DT BLIS_FLOAT
+
 
 typedef enum ukr_pref_e
 {
@@ -925,6 +967,21 @@ typedef enum bszid_e
 	BLIS_KC_SUP,
 	BLIS_NC_SUP,
 
+	// int8 gemm block sizes
+	BLIS_MR_I8,
+	BLIS_NR_I8,
+	BLIS_MC_I8,
+	BLIS_KC_I8,
+	BLIS_NC_I8,
+
+	// block sizes for the gemm micro-kernel with the opposite storage
+	// preference (BLIS_GEMM_ALT_UKR)
+	BLIS_MR_ALT,
+	BLIS_NR_ALT,
+	BLIS_MC_ALT,
+	BLIS_KC_ALT,
+	BLIS_NC_ALT,
+
 	// BLIS_NO_PART (= BLIS_NUM_BLKSZS) must be last!
 	BLIS_NO_PART, // used as a placeholder when blocksizes are not applicable,
 	              // such as when characterizing a packm operation.
@@ -968,6 +1025,8 @@ typedef enum arch_e
 	BLIS_ARCH_PENRYN,
 
 	// AMD
+	BLIS_ARCH_ZEN5,
+	BLIS_ARCH_ZEN4,
 	BLIS_ARCH_ZEN3,
 	BLIS_ARCH_ZEN2,
 	BLIS_ARCH_ZEN,
@@ -1085,16 +1144,50 @@ typedef struct apool_s
 
 // -- packing block allocator: Locked set of pools type --
 
-typedef struct pba_s
+typedef struct pba_slot_s
+{
+	// The state of the slot: empty, full, or busy (while a thread is
+	// placing a block into, or removing a block from, the slot).
+	gint_t              state;
+	pblk_t              block;
+
+	// We insert a cache line of padding here to eliminate false sharing
+	// between the slots of different threads.
+	char                padding[ BLIS_CACHE_LINE_SIZE ];
+
+} pba_slot_t;
+
+typedef struct pba_node_s
 {
 	pool_t              pools[3];
 	bli_pthread_mutex_t mutex;
 
+	// A cache of blocks that have been checked out from each pool but which
+	// may be reused without acquiring the mutex.
+	pba_slot_t          cache[3][ BLIS_PBA_CACHE_SLOTS ];
+
+	// We insert a cache line of padding here to eliminate false sharing
+	// between the mutexes of different nodes.
+	char                padding[ BLIS_CACHE_LINE_SIZE ];
+
+} pba_node_t;
+
+typedef struct pba_s
+{
+	// Each NUMA node has its own locked set of pools so that a packing
+	// block is only ever recycled among threads on the node on which its
+	// pages were first touched.
+	pba_node_t          nodes[ BLIS_NUMA_MAX_NODES ];
+	dim_t               num_nodes;
+
 	// These fields are used for general-purpose allocation.
 	siz_t               align_size;
 	malloc_ft           malloc_fp;
 	free_ft             free_fp;
 
+	// Whether new pool blocks are backed by huge pages.
+	bool                huge_pages;
+
 } pba_t;
 
 
@@ -1468,6 +1561,86 @@ typedef struct cntx_s
 } cntx_t;
 
 
+// -- Gemm epilogue types --
+
+typedef enum act_e
+{
+	BLIS_ACT_NONE = 0,
+	BLIS_ACT_RELU,
+	BLIS_ACT_GELU,
+	BLIS_ACT_CLAMP
+} act_t;
+
+#define BLIS_NUM_ACT_TYPES 4
+
+// A user-supplied function applied to each m x n tile of C (in the
+// orientation of the C passed to bli_gemm_ex()) whose top-left element is
+// located at (off_m,off_n) within C.
+typedef void (*gemm_epilogue_ft)
+     (
+       num_t dt,
+       dim_t m,
+       dim_t n,
+       dim_t off_m,
+       dim_t off_n,
+       void* c, inc_t rs_c, inc_t cs_c,
+       void* params
+     );
+
+// NOTE: The fields of this struct are applied in the order given:
+//   C := func( act( scale .* C + bias ) ),
+// where scale and bias are optional vectors (NULL means absent) that are
+// broadcast across C. Their side indicates whether they hold one element
+// per row (BLIS_LEFT) or per column (BLIS_RIGHT) of C.
+
+typedef struct gemm_epilogue_s
+{
+	const obj_t*           scale;
+	      side_t           scale_side;
+
+	const obj_t*           bias;
+	      side_t           bias_side;
+
+	      act_t            act;
+	      double           act_lo; // lower bound for BLIS_ACT_CLAMP
+	      double           act_hi; // upper bound for BLIS_ACT_CLAMP
+
+	      gemm_epilogue_ft func;
+	      void*            params;
+} gemm_epilogue_t;
+
+
+// -- Gemm prologue types --
+
+// A user-supplied function applied to each m x n micropanel of an operand
+// of gemm immediately after it is packed. The micropanel is presented in
+// the orientation of trans?(A) (or trans?(B)) as seen by bli_gemm_ex(), and
+// its top-left element is located at (off_m,off_n) within that operand.
+typedef void (*packm_prologue_ft)
+     (
+       num_t dt,
+       dim_t m,
+       dim_t n,
+       dim_t off_m,
+       dim_t off_n,
+       void* p, inc_t rs_p, inc_t cs_p,
+       void* params
+     );
+
+// NOTE: Either function may be NULL, in which case the corresponding
+// operand is packed unmodified. With both present, bli_gemm_ex() computes
+//   C := beta * C + alpha * func_a( trans?(A) ) * func_b( trans?(B) ).
+
+typedef struct gemm_prologue_s
+{
+	packm_prologue_ft func_a;
+	void*             params_a;
+
+	packm_prologue_ft func_b;
+	void*             params_b;
+} gemm_prologue_t;
+
+
 // -- Runtime type --
 
 // NOTE: The order of these fields must be kept consistent with the definition
@@ -1485,6 +1658,10 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	bool      jrir_dyn; // claim jr/ir microtiles dynamically in gemm.
+
+	const gemm_epilogue_t* epilogue; // fused write-back for bli_gemm_ex().
+	const gemm_prologue_t* prologue; // fused packing transform for bli_gemm_ex().
 } rntm_t;
 
 
@@ -1520,6 +1697,7 @@ typedef enum err_e
 	BLIS_INVALID_DIAG                          = ( -24),
 	BLIS_INVALID_MACHVAL                       = ( -25),
 	BLIS_EXPECTED_NONUNIT_DIAG                 = ( -26),
+	BLIS_INVALID_ACTIVATION                    = ( -27),
 
 	// Datatype-specific errors
 	BLIS_INVALID_DATATYPE                      = ( -30),
@@ -1570,6 +1748,9 @@ typedef enum err_e
 	// Packing-specific errors
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK  = (-100),
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART    = (-101),
+	BLIS_PACKED_OBJECT_BLKSZ_MISMATCH          = (-102),
+	BLIS_INVALID_PACKED_OBJECT_VIEW            = (-103),
+	BLIS_PACKED_OBJECT_REQUIRES_SUP            = (-104),
 
 	// Buffer-specific errors
 	BLIS_EXPECTED_NONNULL_OBJECT_BUFFER        = (-110),
@@ -777,6 +777,8 @@
 #define VMOVDQA(_0, _1) INSTR_(vmovdqa, _0, _1)
 #define VMOVDQA32(_0, _1) INSTR_(vmovdqa32, _0, _1)
 #define VMOVDQA64(_0, _1) INSTR_(vmovdqa64, _0, _1)
+#define VMASKMOVPS(_0, _1, _2) INSTR_(vmaskmovps, _0, _1, _2)
+#define VMASKMOVPD(_0, _1, _2) INSTR_(vmaskmovpd, _0, _1, _2)
 #define VBROADCASTSS(_0, _1) INSTR_(vbroadcastss, _0, _1)
 #define VBROADCASTSD(_0, _1) INSTR_(vbroadcastsd, _0, _1)
 #define VPBROADCASTD(_0, _1) INSTR_(vpbroadcastd, _0, _1)
@@ -810,6 +812,8 @@
 #define vmovdqa(_0, _1) VMOVDQA(_0, _1)
 #define vmovdqa32(_0, _1) VMOVDQA32(_0, _1)
 #define vmovdqa64(_0, _1) VMOVDQA64(_0, _1)
+#define vmaskmovps(_0, _1, _2) VMASKMOVPS(_0, _1, _2)
+#define vmaskmovpd(_0, _1, _2) VMASKMOVPD(_0, _1, _2)
 #define vbroadcastss(_0, _1) VBROADCASTSS(_0, _1)
 #define vbroadcastsd(_0, _1) VBROADCASTSD(_0, _1)
 #define vpbroadcastd(_0, _1) VPBROADCASTD(_0, _1)
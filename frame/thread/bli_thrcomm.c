@@ -149,6 +149,10 @@ void bli_thrcomm_init( timpl_t ti, dim_t nt, thrcomm_t* comm )
 	// Call the threading-specific init function.
 	fp( nt, comm );
 
+	// Start with all work unclaimed.
+	comm->work_next = 0;
+	comm->work_done = 0;
+
 	// NOTE: The init function that just returned intrinsically knows its
 	// timpl_t value, thus is able to set that value without us explicitly
 	// passing it in.
@@ -185,6 +189,21 @@ void bli_thrcomm_barrier( dim_t tid, thrcomm_t* comm )
 	fp( tid, comm );
 }
 
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+#define __ATOMIC_RELEASE
+#define __ATOMIC_ACQ_REL
+
+#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
+#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
+#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
+#define __atomic_fetch_xor( ptr, value, constraint ) __sync_fetch_and_xor( ptr, value )
+
+#endif
+
 // -- Other functions ----------------------------------------------------------
 
 void* bli_thrcomm_bcast
@@ -205,22 +224,162 @@ void* bli_thrcomm_bcast
 	return object;
 }
 
+dim_t bli_thrcomm_claim
+     (
+       dim_t      n_units,
+       dim_t      n_total,
+       thrcomm_t* comm
+     )
+{
+	// Claim the next n_units units of work out of n_total, returning the
+	// index of the first one. A return value of n_total (or more) means that
+	// all of the work has already been claimed, in which case the calling
+	// thread must not claim again before it has passed a barrier with the
+	// other threads of the communicator.
+	dim_t start = __atomic_fetch_add( &comm->work_next, n_units, __ATOMIC_RELAXED );
+
+	if ( start < n_total ) return start;
+
+	// Once every thread has found the work exhausted, nothing else will
+	// touch the counter until after the barrier, so the last such thread
+	// resets it for the next round.
+	if ( __atomic_add_fetch( &comm->work_done, 1, __ATOMIC_ACQ_REL ) == comm->n_threads )
+	{
+		comm->work_next = 0;
+		comm->work_done = 0;
+	}
+
+	return n_total;
+}
+
 #ifndef BLIS_TREE_BARRIER
 
-// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
-#ifndef __ATOMIC_RELAXED
+// The number of threads at or above which the atomic barrier uses a combining
+// tree. This value is set when the threading sub-API is initialized.
+static dim_t barrier_tree_thresh = BLIS_BARRIER_TREE_THRESH;
 
-#define __ATOMIC_RELAXED
-#define __ATOMIC_ACQUIRE
-#define __ATOMIC_RELEASE
-#define __ATOMIC_ACQ_REL
+void bli_thrcomm_barrier_tree_thresh_init( void )
+{
+	barrier_tree_thresh = bli_env_get_var( "BLIS_BARRIER_TREE_THRESH",
+	                                       BLIS_BARRIER_TREE_THRESH );
+}
 
-#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
-#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
-#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
-#define __atomic_fetch_xor( ptr, value, constraint ) __sync_fetch_and_xor( ptr, value )
+void bli_thrcomm_init_atomic( dim_t n_threads, thrcomm_t* comm )
+{
+	comm->barrier_sense           = 0;
+	comm->barrier_threads_arrived = 0;
+	comm->barrier_nodes           = NULL;
 
-#endif
+	if ( barrier_tree_thresh <= 0 || n_threads < barrier_tree_thresh ||
+	     n_threads <= BLIS_BARRIER_TREE_ARITY ) return;
+
+	const dim_t arity = BLIS_BARRIER_TREE_ARITY;
+
+	// Count the nodes in the tree. Each level has 1/arity as many nodes as
+	// the level below it, with the leaves (level 0) receiving the threads.
+	dim_t n_nodes = 0;
+	for ( dim_t n_level = n_threads; 1 < n_level; )
+	{
+		n_level  = ( n_level + arity - 1 ) / arity;
+		n_nodes += n_level;
+	}
+
+	err_t r_val;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrcomm_init_atomic(): " );
+	#endif
+	thrcomm_node_t* nodes = bli_malloc_intl( sizeof( thrcomm_node_t ) * n_nodes, &r_val );
+
+	// If the allocation failed, we simply fall back to the centralized
+	// barrier.
+	if ( nodes == NULL ) return;
+
+	// Initialize the nodes one level at a time. The nodes of each level are
+	// stored contiguously, beginning with the leaves, such that the j-th
+	// arrival (thread or child node) of a level with n_below arrivals goes
+	// to node j / arity of the level above it.
+	dim_t off_below = -n_threads;
+	dim_t n_below   = n_threads;
+	dim_t off       = 0;
+
+	while ( 1 < n_below )
+	{
+		const dim_t n_level = ( n_below + arity - 1 ) / arity;
+
+		for ( dim_t j = 0; j < n_level; ++j )
+		{
+			nodes[ off + j ].count      = 0;
+			nodes[ off + j ].n_arrivals = bli_min( arity, n_below - j * arity );
+			nodes[ off + j ].parent     = -1;
+		}
+
+		// Link the nodes of the level below (if it consists of nodes rather
+		// than threads) to their parents.
+		if ( 0 <= off_below )
+		{
+			for ( dim_t j = 0; j < n_below; ++j )
+				nodes[ off_below + j ].parent = off + j / arity;
+		}
+
+		off_below = off;
+		n_below   = n_level;
+		off      += n_level;
+	}
+
+	comm->barrier_nodes = nodes;
+}
+
+void bli_thrcomm_cleanup_atomic( thrcomm_t* comm )
+{
+	if ( comm == NULL || comm->barrier_nodes == NULL ) return;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrcomm_cleanup_atomic(): " );
+	#endif
+	bli_free_intl( comm->barrier_nodes );
+
+	comm->barrier_nodes = NULL;
+}
+
+static void bli_thrcomm_barrier_atomic_tree( dim_t t_id, thrcomm_t* comm )
+{
+	thrcomm_node_t* nodes = comm->barrier_nodes;
+
+	// Read the sense variable, as in the centralized barrier below.
+	gint_t orig_sense = __atomic_load_n( &comm->barrier_sense, __ATOMIC_RELAXED );
+
+	// Arrive at our leaf node. The last thread to arrive at a node resets the
+	// node and proceeds to arrive at the node's parent on behalf of all of
+	// the node's arrivals. Thus, each counter is only ever contended by at
+	// most arity threads.
+	dim_t i = t_id / BLIS_BARRIER_TREE_ARITY;
+
+	while ( TRUE )
+	{
+		thrcomm_node_t* node = &nodes[ i ];
+
+		dim_t my_arrivals =
+		__atomic_add_fetch( &node->count, 1, __ATOMIC_ACQ_REL );
+
+		if ( my_arrivals < node->n_arrivals ) break;
+
+		node->count = 0;
+
+		// If the current thread completed the root node, then all threads
+		// have arrived. Toggle the sense variable to release them.
+		if ( node->parent < 0 )
+		{
+			__atomic_fetch_xor( &comm->barrier_sense, 1, __ATOMIC_RELEASE );
+			return;
+		}
+
+		i = node->parent;
+	}
+
+	while ( __atomic_load_n( &comm->barrier_sense, __ATOMIC_ACQUIRE ) == orig_sense )
+		; // Empty loop body.
+}
 
 void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 {
@@ -228,6 +387,13 @@ void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 	// thread participating.
 	if ( comm == NULL || comm->n_threads == 1 ) return;
 
+	// Use the combining tree if one was created for this communicator.
+	if ( comm->barrier_nodes != NULL )
+	{
+		bli_thrcomm_barrier_atomic_tree( t_id, comm );
+		return;
+	}
+
 	// Read the "sense" variable. This variable is akin to a unique ID for
 	// the current barrier. The first n-1 threads will spin on this variable
 	// until it changes. The sense variable gets incremented by the last
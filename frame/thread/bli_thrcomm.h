@@ -67,6 +67,40 @@ typedef struct barrier_s barrier_t;
 #endif
 #endif
 
+// Define thrcomm_node_t, which is a node of the combining tree used by the
+// atomic barrier when a communicator has many threads. This needs to be done
+// first since it is used within the definition of thrcomm_t below.
+
+// The minimum number of threads for which a communicator uses the combining
+// tree barrier instead of the centralized barrier. This default may be
+// overridden at runtime via the BLIS_BARRIER_TREE_THRESH environment variable.
+// A threshold of zero disables the tree barrier.
+#ifndef BLIS_BARRIER_TREE_THRESH
+#define BLIS_BARRIER_TREE_THRESH 16
+#endif
+
+// The number of threads (or child nodes) that arrive at each node of the
+// combining tree.
+#ifndef BLIS_BARRIER_TREE_ARITY
+#define BLIS_BARRIER_TREE_ARITY  4
+#endif
+
+typedef struct thrcomm_node_s
+{
+	// The number of threads (or child nodes) that have arrived at this node
+	// during the current barrier episode.
+	dim_t  count;
+
+	// The number of arrivals that complete this node, and the index of this
+	// node's parent (or -1 for the root).
+	dim_t  n_arrivals;
+	dim_t  parent;
+
+	// We insert a cache line of padding here so that the counters of
+	// different nodes do not share a cache line.
+	char   padding[ BLIS_CACHE_LINE_SIZE ];
+} thrcomm_node_t;
+
 // Define hpx_barrier_t, which is specific to the barrier used in HPX
 // implementation. This needs to be done first since it is (potentially)
 // used within the definition of thrcomm_t below.
@@ -112,6 +146,22 @@ typedef struct thrcomm_s
 	// the fields above and whatever data structures follow.
 	char   padding3[ BLIS_CACHE_LINE_SIZE ];
 
+	// If the communicator has enough threads, the atomic barrier combines
+	// arrivals within this tree of nodes, with threads 0..arity-1 arriving
+	// at node 0, threads arity..2*arity-1 at node 1, and so forth, rather
+	// than at barrier_threads_arrived. Otherwise this field is NULL.
+	thrcomm_node_t* barrier_nodes;
+
+	// A shared counter from which the threads of the communicator may claim
+	// units of work dynamically (see bli_thrcomm_claim()), along with the
+	// number of threads that have found the work exhausted.
+	dim_t  work_next;
+	dim_t  work_done;
+
+	// We insert a cache line of padding here to eliminate false sharing between
+	// the fields above and whatever data structures follow.
+	char   padding4[ BLIS_CACHE_LINE_SIZE ];
+
 	// -- Fields specific to OpenMP --
 
 	#ifdef BLIS_ENABLE_OPENMP
@@ -186,7 +236,12 @@ BLIS_EXPORT_BLIS void  bli_thrcomm_barrier( dim_t thread_id, thrcomm_t* comm );
 
 // Other function prototypes.
 BLIS_EXPORT_BLIS void* bli_thrcomm_bcast( dim_t inside_id, void* to_send, thrcomm_t* comm );
+BLIS_EXPORT_BLIS dim_t bli_thrcomm_claim( dim_t n_units, dim_t n_total, thrcomm_t* comm );
+void                   bli_thrcomm_init_atomic( dim_t n_threads, thrcomm_t* comm );
+void                   bli_thrcomm_cleanup_atomic( thrcomm_t* comm );
 void                   bli_thrcomm_barrier_atomic( dim_t thread_id, thrcomm_t* comm );
 
+void                   bli_thrcomm_barrier_tree_thresh_init( void );
+
 #endif
 
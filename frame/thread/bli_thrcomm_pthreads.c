@@ -80,13 +80,13 @@ void bli_thrcomm_init_pthreads( dim_t n_threads, thrcomm_t* comm )
 	comm->sent_object             = NULL;
 	comm->n_threads               = n_threads;
 	comm->ti                      = BLIS_POSIX;
-	comm->barrier_sense           = 0;
-	comm->barrier_threads_arrived = 0;
+
+	bli_thrcomm_init_atomic( n_threads, comm );
 }
 
 void bli_thrcomm_cleanup_pthreads( thrcomm_t* comm )
 {
-	return;
+	bli_thrcomm_cleanup_atomic( comm );
 }
 
 void bli_thrcomm_barrier_pthreads( dim_t t_id, thrcomm_t* comm )
@@ -44,6 +44,7 @@ void bli_thrcomm_init_single( dim_t n_threads, thrcomm_t* comm )
 	comm->ti                      = BLIS_SINGLE;
 	comm->barrier_sense           = 0;
 	comm->barrier_threads_arrived = 0;
+	comm->barrier_nodes           = NULL;
 }
 
 void bli_thrcomm_cleanup_single( thrcomm_t* comm )
@@ -80,11 +80,21 @@ int bli_thread_init( void )
 
 	bli_thrcomm_init( BLIS_SINGLE, 1, &BLIS_SINGLE_COMM );
 
+#ifndef BLIS_TREE_BARRIER
+	bli_thrcomm_barrier_tree_thresh_init();
+#endif
+
 	return 0;
 }
 
 int bli_thread_finalize( void )
 {
+#ifdef BLIS_ENABLE_PTHREADS
+	// Terminate the worker threads of the persistent thread pool, if any
+	// were created.
+	bli_thread_pool_finalize_pthreads();
+#endif
+
 	bli_thrcomm_cleanup( &BLIS_SINGLE_COMM );
 
 	return 0;
@@ -92,6 +102,36 @@ int bli_thread_finalize( void )
 
 // -----------------------------------------------------------------------------
 
+// Whether the calling thread is currently executing a function launched via
+// bli_thread_launch(). This allows operations that may be called from within
+// an already-parallelized operation (e.g. level-2 operations called from sup
+// kernels) to avoid spawning threads of their own.
+static BLIS_THREAD_LOCAL bool thread_in_parallel = FALSE;
+
+bool bli_thread_in_parallel( void )
+{
+	return thread_in_parallel;
+}
+
+typedef struct
+{
+	      thread_func_t func;
+	const void*         params;
+} thread_launch_params_t;
+
+static void bli_thread_launch_entry( thrcomm_t* gl_comm, dim_t tid, const void* params )
+{
+	const thread_launch_params_t* launch = params;
+
+	const bool in_parallel = thread_in_parallel;
+
+	thread_in_parallel = TRUE;
+
+	launch->func( gl_comm, tid, launch->params );
+
+	thread_in_parallel = in_parallel;
+}
+
 void bli_thread_launch
      (
              timpl_t       ti,
@@ -100,7 +140,52 @@ void bli_thread_launch
        const void*         params
      )
 {
-	thread_launch_fpa[ti]( nt, func, params );
+	thread_launch_params_t launch = { func, params };
+
+	thread_launch_fpa[ti]( nt, bli_thread_launch_entry, &launch );
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_thread_query_nt
+     (
+             dim_t    n_elem,
+             dim_t    n_elem_min,
+       const rntm_t*  rntm,
+             timpl_t* ti
+     )
+{
+	*ti = BLIS_SINGLE;
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+	// Don't bother querying the rntm_t if the operation is too small to be
+	// split among even two threads, or if we are already executing within
+	// a parallel region.
+	if ( n_elem < 2 * n_elem_min || bli_thread_in_parallel() ) return 1;
+
+	rntm_t rntm_l;
+
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm; bli_rntm_sanitize( &rntm_l ); }
+
+	if ( bli_rntm_thread_impl( &rntm_l ) == BLIS_SINGLE ) return 1;
+
+	// Cap the number of threads so that each is assigned at least n_elem_min
+	// elements.
+	dim_t nt = bli_min( bli_rntm_num_threads( &rntm_l ), n_elem / n_elem_min );
+
+	if ( nt < 2 ) return 1;
+
+	*ti = bli_rntm_thread_impl( &rntm_l );
+
+	return nt;
+#else
+	( void )n_elem;
+	( void )n_elem_min;
+	( void )rntm;
+
+	return 1;
+#endif
 }
 
 // -----------------------------------------------------------------------------
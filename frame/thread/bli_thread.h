@@ -66,6 +66,16 @@ BLIS_EXPORT_BLIS void bli_thread_launch
        const void*         params
      );
 
+bool bli_thread_in_parallel( void );
+
+dim_t bli_thread_query_nt
+     (
+             dim_t    n_elem,
+             dim_t    n_elem_min,
+       const rntm_t*  rntm,
+             timpl_t* ti
+     );
+
 // -----------------------------------------------------------------------------
 
 // Factorization and partitioning prototypes
@@ -36,6 +36,26 @@
 
 #ifdef BLIS_ENABLE_PTHREADS
 
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+#define __ATOMIC_RELEASE
+#define __ATOMIC_ACQ_REL
+
+#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
+#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
+
+#endif
+
+// The number of times that an idle worker thread (or the chief thread, while
+// waiting for the workers to finish) polls for a state change before it parks
+// itself on a condition variable.
+#ifndef BLIS_THREAD_POOL_SPIN_COUNT
+#define BLIS_THREAD_POOL_SPIN_COUNT 100000
+#endif
+
 // A data structure to assist in passing operands to additional threads.
 typedef struct thread_data
 {
@@ -62,15 +82,284 @@ static void* bli_posix_thread_entry( void* data_void )
 	return NULL;
 }
 
-void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void* params )
+// -----------------------------------------------------------------------------
+
+// The thread pool consists of worker threads that are created the first time
+// they are needed and then kept alive until the library is finalized. Worker
+// w executes as thread id w + 1 while the application thread that launched the
+// parallel region executes as thread id 0. Only one application thread may use
+// the pool at a time; any launch that finds the pool busy (including nested
+// launches from within a parallel region) falls back to spawning and joining
+// its own threads.
+typedef struct thread_pool_worker_s
+{
+	bli_pthread_t thread;
+	dim_t         id;
+
+	// This counter is incremented each time the worker is given a new
+	// parallel region to execute (or is asked to shut down). Each worker
+	// has its own counter so that the workers that are not needed by a
+	// parallel region are left undisturbed.
+	gint_t        generation;
+
+	// We pad the struct so that the counters of different workers do not
+	// share a cache line.
+	char          padding[ BLIS_CACHE_LINE_SIZE ];
+} thread_pool_worker_t;
+
+typedef struct thread_pool_s
 {
+	// This lock is held by the application thread that is currently using
+	// the pool, and also protects the fields below that are not updated
+	// atomically.
+	bli_pthread_mutex_t    lock;
+
+	thread_pool_worker_t** workers;
+	dim_t                  n_workers;
+
+	// Data describing the current parallel region. These fields are written
+	// by the chief thread before it posts the region to the workers.
+	thread_data_t          job;
+	dim_t                  n_active;
+	gint_t                 n_done;
+	bool                   shutdown;
+
+	// A mutex and two condition variables on which idle workers and the
+	// waiting chief thread, respectively, park once they have finished
+	// spinning.
+	bli_pthread_mutex_t    park_mutex;
+	bli_pthread_cond_t     work_cond;
+	bli_pthread_cond_t     done_cond;
+} thread_pool_t;
+
+static thread_pool_t thread_pool =
+{
+	.lock       = BLIS_PTHREAD_MUTEX_INITIALIZER,
+	.workers    = NULL,
+	.n_workers  = 0,
+	.n_active   = 0,
+	.n_done     = 0,
+	.shutdown   = FALSE,
+	.park_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER,
+	.work_cond  = BLIS_PTHREAD_COND_INITIALIZER,
+	.done_cond  = BLIS_PTHREAD_COND_INITIALIZER,
+};
+
+static void* bli_thread_pool_worker_entry( void* data_void )
+{
+	thread_pool_t*        pool   = &thread_pool;
+	thread_pool_worker_t* worker = data_void;
+
+	// The worker's counter is zero when it is created. (Note that we must not
+	// read the counter here since a parallel region may already have been
+	// posted by the time this thread starts running.)
+	gint_t seen = 0;
+
+	while ( TRUE )
+	{
+		// Wait for the generation counter to change, spinning for a while
+		// before parking on the condition variable.
+		gint_t gen = __atomic_load_n( &worker->generation, __ATOMIC_ACQUIRE );
+
+		for ( dim_t i = 0; gen == seen && i < BLIS_THREAD_POOL_SPIN_COUNT; ++i )
+			gen = __atomic_load_n( &worker->generation, __ATOMIC_ACQUIRE );
+
+		if ( gen == seen )
+		{
+			bli_pthread_mutex_lock( &pool->park_mutex );
+
+			while ( ( gen = __atomic_load_n( &worker->generation, __ATOMIC_ACQUIRE ) ) == seen )
+				bli_pthread_cond_wait( &pool->work_cond, &pool->park_mutex );
+
+			bli_pthread_mutex_unlock( &pool->park_mutex );
+		}
+
+		seen = gen;
+
+		if ( pool->shutdown ) break;
+
+		const dim_t n_active = pool->n_active;
+
+		pool->job.func( pool->job.gl_comm, worker->id + 1, pool->job.params );
+
+		// The last worker to finish wakes up the chief thread in case it
+		// has parked.
+		if ( __atomic_add_fetch( &pool->n_done, 1, __ATOMIC_ACQ_REL ) == n_active )
+		{
+			bli_pthread_mutex_lock( &pool->park_mutex );
+			bli_pthread_cond_broadcast( &pool->done_cond );
+			bli_pthread_mutex_unlock( &pool->park_mutex );
+		}
+	}
+
+	return NULL;
+}
+
+static void bli_thread_pool_post( thread_pool_t* pool, dim_t n_workers )
+{
+	// Publish the data written prior to this call to the first n_workers
+	// workers and wake up any of them that have parked. The counters are
+	// incremented while holding park_mutex so that a worker cannot observe
+	// the old value and then miss the broadcast.
+	bli_pthread_mutex_lock( &pool->park_mutex );
+
+	for ( dim_t w = 0; w < n_workers; ++w )
+		__atomic_add_fetch( &pool->workers[ w ]->generation, 1, __ATOMIC_ACQ_REL );
+
+	bli_pthread_cond_broadcast( &pool->work_cond );
+	bli_pthread_mutex_unlock( &pool->park_mutex );
+}
+
+static bool bli_thread_pool_grow( thread_pool_t* pool, dim_t n_workers )
+{
+	// NOTE: This function must be called with the pool's lock held.
+
+	if ( n_workers <= pool->n_workers ) return TRUE;
+
 	err_t r_val;
 
-	const timpl_t ti = BLIS_POSIX;
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_pool_grow(): " );
+	#endif
+	thread_pool_worker_t** workers = bli_malloc_intl( sizeof( thread_pool_worker_t* ) * n_workers, &r_val );
 
-	// Allocate a global communicator for the root thrinfo_t structures.
-	pool_t*    gl_comm_pool = NULL;
-	thrcomm_t* gl_comm      = bli_thrcomm_create( ti, gl_comm_pool, n_threads );
+	if ( workers == NULL ) return FALSE;
+
+	for ( dim_t w = 0; w < pool->n_workers; ++w )
+		workers[ w ] = pool->workers[ w ];
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_pool_grow(): " );
+	#endif
+	bli_free_intl( pool->workers );
+
+	pool->workers = workers;
+
+	for ( dim_t w = pool->n_workers; w < n_workers; ++w )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thread_pool_grow(): " );
+		#endif
+		thread_pool_worker_t* worker = bli_malloc_intl( sizeof( thread_pool_worker_t ), &r_val );
+
+		if ( worker == NULL ) return FALSE;
+
+		worker->id         = w;
+		worker->generation = 0;
+
+		if ( bli_pthread_create( &worker->thread, NULL, &bli_thread_pool_worker_entry, worker ) != 0 )
+		{
+			bli_free_intl( worker );
+			return FALSE;
+		}
+
+		workers[ w ]    = worker;
+		pool->n_workers = w + 1;
+	}
+
+	return TRUE;
+}
+
+void bli_thread_pool_finalize_pthreads( void )
+{
+	thread_pool_t* pool = &thread_pool;
+
+	bli_pthread_mutex_lock( &pool->lock );
+
+	pool->shutdown = TRUE;
+
+	bli_thread_pool_post( pool, pool->n_workers );
+
+	for ( dim_t w = 0; w < pool->n_workers; ++w )
+	{
+		bli_pthread_join( pool->workers[ w ]->thread, NULL );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thread_pool_finalize_pthreads(): " );
+		#endif
+		bli_free_intl( pool->workers[ w ] );
+	}
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_pool_finalize_pthreads(): " );
+	#endif
+	bli_free_intl( pool->workers );
+
+	pool->workers   = NULL;
+	pool->n_workers = 0;
+	pool->shutdown  = FALSE;
+
+	bli_pthread_mutex_unlock( &pool->lock );
+}
+
+static bool bli_thread_pool_launch
+     (
+             dim_t         n_threads,
+             thrcomm_t*    gl_comm,
+             thread_func_t func,
+       const void*         params
+     )
+{
+	thread_pool_t* pool = &thread_pool;
+
+	// Give up if some other thread is currently using the pool.
+	if ( bli_pthread_mutex_trylock( &pool->lock ) != 0 ) return FALSE;
+
+	const dim_t n_active = n_threads - 1;
+
+	// Make sure there are enough workers to execute the parallel region. If
+	// we can only create some of them, the ones that were created are kept
+	// for later use, but the current region is executed without the pool.
+	if ( !bli_thread_pool_grow( pool, n_active ) )
+	{
+		bli_pthread_mutex_unlock( &pool->lock );
+		return FALSE;
+	}
+
+	pool->job.tid     = 0;
+	pool->job.gl_comm = gl_comm;
+	pool->job.func    = func;
+	pool->job.params  = params;
+	pool->n_active    = n_active;
+	pool->n_done      = 0;
+
+	bli_thread_pool_post( pool, n_active );
+
+	// The chief thread executes as thread id 0.
+	func( gl_comm, 0, params );
+
+	// Wait for the workers to finish, spinning for a while before parking.
+	bool done = FALSE;
+
+	for ( dim_t i = 0; !done && i < BLIS_THREAD_POOL_SPIN_COUNT; ++i )
+		done = __atomic_load_n( &pool->n_done, __ATOMIC_ACQUIRE ) == n_active;
+
+	if ( !done )
+	{
+		bli_pthread_mutex_lock( &pool->park_mutex );
+
+		while ( __atomic_load_n( &pool->n_done, __ATOMIC_ACQUIRE ) != n_active )
+			bli_pthread_cond_wait( &pool->done_cond, &pool->park_mutex );
+
+		bli_pthread_mutex_unlock( &pool->park_mutex );
+	}
+
+	bli_pthread_mutex_unlock( &pool->lock );
+
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_thread_launch_pthreads_spawn
+     (
+             dim_t         n_threads,
+             thrcomm_t*    gl_comm,
+             thread_func_t func,
+       const void*         params
+     )
+{
+	err_t r_val;
 
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
@@ -108,10 +397,6 @@ void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void
 		bli_pthread_join( pthreads[tid], NULL );
 	}
 
-	// Free the global communicator, because the root thrinfo_t node
-	// never frees its communicator.
-	bli_thrcomm_free( gl_comm_pool, gl_comm );
-
 	// Free the array of pthread objects and auxiliary data structs.
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
@@ -124,5 +409,25 @@ void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void
 	bli_free_intl( datas );
 }
 
+void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void* params )
+{
+	const timpl_t ti = BLIS_POSIX;
+
+	// Allocate a global communicator for the root thrinfo_t structures.
+	pool_t*    gl_comm_pool = NULL;
+	thrcomm_t* gl_comm      = bli_thrcomm_create( ti, gl_comm_pool, n_threads );
+
+	// Execute the parallel region on the persistent thread pool if it is
+	// available, and otherwise on a set of freshly spawned threads.
+	if ( n_threads == 1 )
+		func( gl_comm, 0, params );
+	else if ( !bli_thread_pool_launch( n_threads, gl_comm, func, params ) )
+		bli_thread_launch_pthreads_spawn( n_threads, gl_comm, func, params );
+
+	// Free the global communicator, because the root thrinfo_t node
+	// never frees its communicator.
+	bli_thrcomm_free( gl_comm_pool, gl_comm );
+}
+
 #endif
 
@@ -45,6 +45,8 @@ void bli_thread_launch_pthreads
        const void*         params
      );
 
+void bli_thread_pool_finalize_pthreads( void );
+
 #endif
 
 #endif
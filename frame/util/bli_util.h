@@ -60,3 +60,6 @@
 // Prototype level-1m implementations.
 #include "bli_util_unb_var1.h"
 
+// Prototype the multithreaded implementations of vector reductions.
+#include "bli_util_thread.h"
+
@@ -65,6 +65,17 @@ void PASTEMAC(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	/*if ( cntx == NULL ) cntx = bli_gks_query_cntx();*/ \
+\
+	/* If the vector is long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,opname,_thread)( ti, nt, n, x, incx, asum, cntx ); \
+		return; \
+	} \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
@@ -144,6 +155,17 @@ void PASTEMAC(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the vector is long enough, and more than one thread was
+	   requested, partition the operation among the threads. */ \
+	timpl_t ti; \
+	dim_t   nt = bli_thread_query_nt( n, BLIS_L1V_MT_MIN_ELEMS, rntm, &ti ); \
+\
+	if ( 1 < nt ) \
+	{ \
+		PASTEMAC(ch,opname,_thread)( ti, nt, n, x, incx, norm, cntx ); \
+		return; \
+	} \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
@@ -0,0 +1,228 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef struct
+{
+	      dim_t   n;
+	const void*   x; inc_t incx;
+	      void*   norm;
+	      void*   sumsq;
+	const cntx_t* cntx;
+} util_thread_params_t;
+
+// -----------------------------------------------------------------------------
+
+//
+// Define the functions that combine the partial results of two threads.
+//
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static ctype PASTEMAC(ch,opname,_sum)( ctype a, ctype b ) \
+{ \
+	return a + b; \
+} \
+\
+static ctype PASTEMAC(ch,opname,_max)( ctype a, ctype b ) \
+{ \
+	/* As in normiv, a NaN is treated as larger than any other value. */ \
+	return ( a < b || PASTEMAC(ch,isnan)( b ) ? b : a ); \
+}
+
+INSERT_GENTFUNCRO_BASIC( util_combine )
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, varname, combine ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const util_thread_params_t* params = params_void; \
+\
+	const dim_t    nt   = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t    bf   = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	const ctype*   x    = params->x; \
+	      ctype_r* norm = params->norm; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	/* Compute this thread's partial result. */ \
+	PASTEMAC(ch,varname) \
+	( \
+	  end - start, \
+	  ( ctype* )x + start*params->incx, params->incx, \
+	  norm + tid, \
+	  ( cntx_t* )params->cntx, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t  ti, \
+             dim_t    nt, \
+             dim_t    n, \
+       const ctype*   x, inc_t incx, \
+             ctype_r* norm, \
+       const cntx_t*  cntx  \
+     ) \
+{ \
+	err_t r_val; \
+\
+	ctype_r* norm_thr = bli_malloc_intl( nt * sizeof( ctype_r ), &r_val ); \
+\
+	util_thread_params_t params = { n, x, incx, norm_thr, NULL, cntx }; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+\
+	/* Combine the partial results pairwise, in a fixed order. */ \
+	for ( dim_t s = 1; s < nt; s *= 2 ) \
+		for ( dim_t i = 0; i + s < nt; i += 2*s ) \
+			norm_thr[ i ] = PASTEMAC(chr,util_combine,combine) \
+			                ( norm_thr[ i ], norm_thr[ i + s ] ); \
+\
+	*norm = norm_thr[ 0 ]; \
+\
+	bli_free_intl( norm_thr ); \
+}
+
+INSERT_GENTFUNCR_BASIC( asumv_thread,  asumv_unb_var1,  _sum )
+INSERT_GENTFUNCR_BASIC( norm1v_thread, norm1v_unb_var1, _sum )
+INSERT_GENTFUNCR_BASIC( normiv_thread, normiv_unb_var1, _max )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname,_entry)( thrcomm_t* gl_comm, dim_t tid, const void* params_void ) \
+{ \
+	const util_thread_params_t* params = params_void; \
+\
+	const dim_t    nt    = bli_thrcomm_num_threads( gl_comm ); \
+	const dim_t    bf    = bli_max( 1, BLIS_CACHE_LINE_SIZE / sizeof( ctype ) ); \
+	const ctype*   x     = params->x; \
+	      ctype_r* scale = params->norm; \
+	      ctype_r* sumsq = params->sumsq; \
+\
+	dim_t start, end; \
+\
+	bli_thread_range_sub( tid, nt, params->n, bf, FALSE, &start, &end ); \
+\
+	/* Compute this thread's scaled sum of squares. */ \
+	bli_tset0s( chr, scale[ tid ] ); \
+	bli_tset1s( chr, sumsq[ tid ] ); \
+\
+	PASTEMAC(ch,sumsqv_unb_var1) \
+	( \
+	  end - start, \
+	  ( ctype* )x + start*params->incx, params->incx, \
+	  scale + tid, \
+	  sumsq + tid, \
+	  ( cntx_t* )params->cntx, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             timpl_t  ti, \
+             dim_t    nt, \
+             dim_t    n, \
+       const ctype*   x, inc_t incx, \
+             ctype_r* norm, \
+       const cntx_t*  cntx  \
+     ) \
+{ \
+	err_t r_val; \
+\
+	ctype_r* scale = bli_malloc_intl( 2 * nt * sizeof( ctype_r ), &r_val ); \
+	ctype_r* sumsq = scale + nt; \
+\
+	util_thread_params_t params = { n, x, incx, scale, sumsq, cntx }; \
+\
+	bli_thread_launch( ti, nt, PASTEMAC(ch,opname,_entry), &params ); \
+\
+	/* Combine the partial results pairwise, in a fixed order. Each pair
+	   (scale, sumsq) represents the sum of squares scale^2 * sumsq, and
+	   the combined pair uses the larger of the two scales. As in sumsqv,
+	   a NaN takes precedence over an Inf, which takes precedence over any
+	   finite value. */ \
+	for ( dim_t s = 1; s < nt; s *= 2 ) \
+		for ( dim_t i = 0; i + s < nt; i += 2*s ) \
+		{ \
+			const ctype_r scale_a = scale[ i ],     sumsq_a = sumsq[ i ]; \
+			const ctype_r scale_b = scale[ i + s ], sumsq_b = sumsq[ i + s ]; \
+\
+			if ( PASTEMAC(chr,isnan)( sumsq_a ) ) \
+				continue; \
+			else if ( PASTEMAC(chr,isnan)( sumsq_b ) || \
+			          PASTEMAC(chr,isinf)( sumsq_b ) ) \
+			{ \
+				scale[ i ] = scale_b; \
+				sumsq[ i ] = sumsq_b; \
+			} \
+			else if ( PASTEMAC(chr,isinf)( sumsq_a ) || scale_b == 0 ) \
+				continue; \
+			else if ( scale_a == scale_b ) \
+				sumsq[ i ] = sumsq_a + sumsq_b; \
+			else if ( scale_a < scale_b ) \
+			{ \
+				const ctype_r r = scale_a / scale_b; \
+				scale[ i ] = scale_b; \
+				sumsq[ i ] = sumsq_b + sumsq_a * r * r; \
+			} \
+			else \
+			{ \
+				const ctype_r r = scale_b / scale_a; \
+				sumsq[ i ] = sumsq_a + sumsq_b * r * r; \
+			} \
+		} \
+\
+	/* Compute: norm = scale * sqrt( sumsq ) */ \
+	ctype_r sqrt_sumsq; \
+\
+	bli_tsqrt2s( chr,chr,chr, sumsq[ 0 ], sqrt_sumsq ); \
+	bli_tscals( chr,chr,chr, scale[ 0 ], sqrt_sumsq ); \
+	bli_tcopys( chr,chr, sqrt_sumsq, *norm ); \
+\
+	bli_free_intl( scale ); \
+}
+
+INSERT_GENTFUNCR_BASIC( normfv_thread )
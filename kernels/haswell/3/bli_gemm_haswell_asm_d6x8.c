@@ -757,6 +757,14 @@ void bli_sgemm_haswell_asm_6x16
 	vmovlpd(xmm1, mem(rcx, r13, 2)) \
 	vmovhpd(xmm1, mem(rcx, r10, 1))*/
 
+// A window of four consecutive entries starting at (8 - n) or (12 - n)
+// selects the first n columns of a row of an 8-wide microtile.
+static const int64_t dgemm_haswell_6x8_mask[16] =
+{
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	 0,  0,  0,  0,  0,  0,  0,  0
+};
+
 void bli_dgemm_haswell_asm_6x8
      (
              dim_t      m,
@@ -781,7 +789,14 @@ void bli_dgemm_haswell_asm_6x8
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
-	GEMM_UKR_SETUP_CT_AMBI( d, 6, 8, true );
+	// Edge cases with row-stored C are handled in place via vmaskmovpd
+	// (see .DROWSTORMASK below). The mask for the first/second half of
+	// each row of C is read from dgemm_haswell_6x8_mask + 8 - n.
+	uint64_t m_     = m;
+	uint64_t n_     = n;
+	const int64_t* mask = dgemm_haswell_6x8_mask + 8 - n;
+
+	GEMM_UKR_SETUP_CT_AMBI_MASKED( d, 6, 8, true );
 
 	begin_asm()
 
@@ -1053,6 +1068,13 @@ void bli_dgemm_haswell_asm_6x8
 		cmp(imm(8), rdi) // set ZF if (8*rs_c) == 8.
 		jz(.DCOLSTORED) // jump to column storage case
 
+		mov(var(m), r8)
+		mov(var(n), r9)
+		cmp(imm(6), r8) // jump to masked row storage case
+		jne(.DROWSTORMASK) // if m != 6 or n != 8.
+		cmp(imm(8), r9)
+		jne(.DROWSTORMASK)
+
 			vfmadd231pd(mem(rcx), ymm3, ymm4)
 			vmovupd(ymm4, mem(rcx))
 			vfmadd231pd(mem(rcx,32), ymm3, ymm5)
@@ -1096,6 +1118,76 @@ void bli_dgemm_haswell_asm_6x8
 
 			jmp(.DDONE) // jump to end.
 
+		label(.DROWSTORMASK)
+
+			mov(var(mask), rdx) // load the column masks.
+			vmovupd(mem(rdx), ymm1)
+			vmovupd(mem(rdx,32), ymm2)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm4)
+			vmaskmovpd(ymm4, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm5)
+			vmaskmovpd(ymm5, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm6)
+			vmaskmovpd(ymm6, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm7)
+			vmaskmovpd(ymm7, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm8)
+			vmaskmovpd(ymm8, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm9)
+			vmaskmovpd(ymm9, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm10)
+			vmaskmovpd(ymm10, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm11)
+			vmaskmovpd(ymm11, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm12)
+			vmaskmovpd(ymm12, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm13)
+			vmaskmovpd(ymm13, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(mem(rcx), ymm1, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm14)
+			vmaskmovpd(ymm14, ymm1, mem(rcx))
+			vmaskmovpd(mem(rcx,32), ymm2, ymm0)
+			vfmadd231pd(ymm0, ymm3, ymm15)
+			vmaskmovpd(ymm15, ymm2, mem(rcx,32))
+
+			jmp(.DDONE) // jump to end.
+
 		label(.DCOLSTORED)
 
 			vunpcklpd(ymm6, ymm4, ymm0)
@@ -1182,6 +1274,13 @@ void bli_dgemm_haswell_asm_6x8
 		cmp(imm(8), rdi) // set ZF if (8*rs_c) == 8.
 		jz(.DCOLSTORBZ) // jump to column storage case
 
+		mov(var(m), r8)
+		mov(var(n), r9)
+		cmp(imm(6), r8) // jump to masked row storage case
+		jne(.DROWSTORBZMASK) // if m != 6 or n != 8.
+		cmp(imm(8), r9)
+		jne(.DROWSTORBZMASK)
+
 			vmovupd(ymm4, mem(rcx))
 			vmovupd(ymm5, mem(rcx,32))
 			add(rdi, rcx)
@@ -1212,6 +1311,52 @@ void bli_dgemm_haswell_asm_6x8
 
 			jmp(.DDONE) // jump to end.
 
+		label(.DROWSTORBZMASK)
+
+			mov(var(mask), rdx) // load the column masks.
+			vmovupd(mem(rdx), ymm1)
+			vmovupd(mem(rdx,32), ymm2)
+
+			vmaskmovpd(ymm4, ymm1, mem(rcx))
+			vmaskmovpd(ymm5, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(ymm6, ymm1, mem(rcx))
+			vmaskmovpd(ymm7, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(ymm8, ymm1, mem(rcx))
+			vmaskmovpd(ymm9, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(ymm10, ymm1, mem(rcx))
+			vmaskmovpd(ymm11, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(ymm12, ymm1, mem(rcx))
+			vmaskmovpd(ymm13, ymm2, mem(rcx,32))
+
+			add(rdi, rcx)
+			dec(r8) // stop after m rows.
+			je(.DDONE)
+
+			vmaskmovpd(ymm14, ymm1, mem(rcx))
+			vmaskmovpd(ymm15, ymm2, mem(rcx,32))
+
+			jmp(.DDONE) // jump to end.
+
 		label(.DCOLSTORBZ)
 
 			vunpcklpd(ymm6, ymm4, ymm0)
@@ -1289,9 +1434,12 @@ void bli_dgemm_haswell_asm_6x8
 	  [beta]   "m" (beta),   // 5
 	  [c]      "m" (c),      // 6
 	  [rs_c]   "m" (rs_c),   // 7
-	  [cs_c]   "m" (cs_c)/*,   // 8
-	  [b_next] "m" (b_next), // 9
-	  [a_next] "m" (a_next)*/  // 10
+	  [cs_c]   "m" (cs_c),   // 8
+	  [m]      "m" (m_),     // 9
+	  [n]      "m" (n_),     // 10
+	  [mask]   "m" (mask)/*, // 11
+	  [b_next] "m" (b_next), // 12
+	  [a_next] "m" (a_next)*/  // 13
 	: // register clobber list
 	  "rax", "rbx", "rcx", "rdx", "rsi", "rdi",
 	  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
@@ -0,0 +1,109 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   An int8 gemm microkernel for AVX2 that computes a 6x8 tile of int32 dot
+   products. Both micropanels store groups of four consecutive k values per
+   row (of A) or column (of B), with A holding unsigned and B holding signed
+   bytes. Each group of A and B is widened to 16 bits, after which
+   vpmaddwd forms pairwise sums of products directly in 32-bit lanes. This
+   avoids the saturating intermediate of vpmaddubsw, so the result is exact.
+
+   The accumulator for row r and columns 0-3 (or 4-7) holds two partial sums
+   per column, which are reduced with a horizontal add before storing.
+*/
+
+#define I8GEMM_HSW_ROW( r ) \
+	{ \
+		__m256i a_r = _mm256_cvtepu8_epi16( _mm_set1_epi32( *( const int32_t* )( a + 4*r ) ) ); \
+		c ## r ## 0 = _mm256_add_epi32( c ## r ## 0, _mm256_madd_epi16( a_r, b0 ) ); \
+		c ## r ## 1 = _mm256_add_epi32( c ## r ## 1, _mm256_madd_epi16( a_r, b1 ) ); \
+	}
+
+#define I8GEMM_HSW_STORE( r ) \
+	{ \
+		__m256i s_r = _mm256_hadd_epi32( c ## r ## 0, c ## r ## 1 ); \
+		s_r = _mm256_permute4x64_epi64( s_r, 0xD8 ); \
+		_mm256_storeu_si256( ( __m256i* )( ab + r*rs_ab ), s_r ); \
+	}
+
+void bli_i8gemm_haswell_int_6x8
+     (
+             dim_t      k,
+       const void*      a0,
+       const void*      b0_,
+             void*      ab0,
+             inc_t      rs_ab,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const uint8_t* restrict a  = a0;
+	const int8_t*  restrict b  = b0_;
+	      int32_t* restrict ab = ab0;
+
+	__m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+	__m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+	__m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+	__m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+	__m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+	__m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+	for ( dim_t l = 0; l < k; l += 4 )
+	{
+		__m256i b0 = _mm256_cvtepi8_epi16( _mm_loadu_si128( ( const __m128i* )( b +  0 ) ) );
+		__m256i b1 = _mm256_cvtepi8_epi16( _mm_loadu_si128( ( const __m128i* )( b + 16 ) ) );
+
+		I8GEMM_HSW_ROW( 0 )
+		I8GEMM_HSW_ROW( 1 )
+		I8GEMM_HSW_ROW( 2 )
+		I8GEMM_HSW_ROW( 3 )
+		I8GEMM_HSW_ROW( 4 )
+		I8GEMM_HSW_ROW( 5 )
+
+		a += 4 * 6;
+		b += 4 * 8;
+	}
+
+	I8GEMM_HSW_STORE( 0 )
+	I8GEMM_HSW_STORE( 1 )
+	I8GEMM_HSW_STORE( 2 )
+	I8GEMM_HSW_STORE( 3 )
+	I8GEMM_HSW_STORE( 4 )
+	I8GEMM_HSW_STORE( 5 )
+}
+
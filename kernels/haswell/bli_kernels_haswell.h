@@ -64,6 +64,9 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_u_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_haswell_asm_6x8 )
 
+// i8gemm (int 6x8)
+I8GEMM_UKR_PROT( bli_i8gemm_haswell_int_6x8 )
+
 
 // gemm (asm d8x6)
 //GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
@@ -65,6 +65,34 @@
     VMOVUPD(MEM(RCX,64), ZMM(R2)) \
     LEA(RCX, MEM(RCX,RBX,1))
 
+// Edge-case variants of the above, used when m < 16 or n < 14. The rows
+// of each column are loaded and stored under the masks k1 (rows 0-7) and
+// k2 (rows 8-15), and only the first n columns (counted down in RDI) are
+// updated.
+#define UPDATE_C_MASKED(R1,R2) \
+\
+    VMULPD(ZMM(R1), ZMM(R1), ZMM(0)) \
+    VMULPD(ZMM(R2), ZMM(R2), ZMM(0)) \
+    VMOVUPD(ZMM(2) MASK_KZ(1), MEM(RCX)) \
+    VMOVUPD(ZMM(3) MASK_KZ(2), MEM(RCX,64)) \
+    VFMADD231PD(ZMM(R1), ZMM(1), ZMM(2)) \
+    VFMADD231PD(ZMM(R2), ZMM(1), ZMM(3)) \
+    VMOVUPD(MEM(RCX) MASK_K(1), ZMM(R1)) \
+    VMOVUPD(MEM(RCX,64) MASK_K(2), ZMM(R2)) \
+    LEA(RCX, MEM(RCX,RBX,1)) \
+    SUB(RDI, IMM(1)) \
+    JZ(END)
+
+#define UPDATE_C_BZ_MASKED(R1,R2) \
+\
+    VMULPD(ZMM(R1), ZMM(R1), ZMM(0)) \
+    VMULPD(ZMM(R2), ZMM(R2), ZMM(0)) \
+    VMOVUPD(MEM(RCX) MASK_K(1), ZMM(R1)) \
+    VMOVUPD(MEM(RCX,64) MASK_K(2), ZMM(R2)) \
+    LEA(RCX, MEM(RCX,RBX,1)) \
+    SUB(RDI, IMM(1)) \
+    JZ(END)
+
 #define UPDATE_C_COL_SCATTERED(R1,R2) \
 \
     KXNORW(K(1), K(0), K(0)) \
@@ -176,7 +204,14 @@ void bli_dgemm_skx_asm_16x14
     int64_t rs_c = rs_c_;
     int64_t cs_c = cs_c_;
 
-    GEMM_UKR_SETUP_CT( d, 16, 14, false );
+    // Edge cases are handled in place (see UPDATE_C_MASKED), so the
+    // temporary microtile is only needed when C is not column-stored.
+    int64_t  m_    = m;
+    int64_t  n_    = n;
+    uint32_t mask0 = ( 1u << bli_min( m, 8 ) ) - 1;
+    uint32_t mask1 = ( 1u << bli_max( m - 8, 0 ) ) - 1;
+
+    GEMM_UKR_SETUP_CT_MASKED( d, 16, 14, false );
 
     BEGIN_ASM()
 
@@ -328,6 +363,13 @@ void bli_dgemm_skx_asm_16x14
     MOV(RAX, R12)
     MOV(RBX, R10)
 
+    MOV(RSI, VAR(m))
+    MOV(RDI, VAR(n))
+    CMP(RSI, IMM(16))
+    JNE(EDGE)
+    CMP(RDI, IMM(14))
+    JNE(EDGE)
+
     VCOMISD(XMM(1), XMM(2))
     JE(COLSTORBZ)
 
@@ -364,6 +406,47 @@ void bli_dgemm_skx_asm_16x14
         UPDATE_C_BZ(28,29)
         UPDATE_C_BZ(30,31)
 
+    JMP(END)
+    LABEL(EDGE)
+
+    KMOVW(K(1), VAR(mask0))
+    KMOVW(K(2), VAR(mask1))
+
+    VCOMISD(XMM(1), XMM(2))
+    JE(EDGEBZ)
+
+        UPDATE_C_MASKED( 4, 5)
+        UPDATE_C_MASKED( 6, 7)
+        UPDATE_C_MASKED( 8, 9)
+        UPDATE_C_MASKED(10,11)
+        UPDATE_C_MASKED(12,13)
+        UPDATE_C_MASKED(14,15)
+        UPDATE_C_MASKED(16,17)
+        UPDATE_C_MASKED(18,19)
+        UPDATE_C_MASKED(20,21)
+        UPDATE_C_MASKED(22,23)
+        UPDATE_C_MASKED(24,25)
+        UPDATE_C_MASKED(26,27)
+        UPDATE_C_MASKED(28,29)
+        UPDATE_C_MASKED(30,31)
+
+    LABEL(EDGEBZ)
+
+        UPDATE_C_BZ_MASKED( 4, 5)
+        UPDATE_C_BZ_MASKED( 6, 7)
+        UPDATE_C_BZ_MASKED( 8, 9)
+        UPDATE_C_BZ_MASKED(10,11)
+        UPDATE_C_BZ_MASKED(12,13)
+        UPDATE_C_BZ_MASKED(14,15)
+        UPDATE_C_BZ_MASKED(16,17)
+        UPDATE_C_BZ_MASKED(18,19)
+        UPDATE_C_BZ_MASKED(20,21)
+        UPDATE_C_BZ_MASKED(22,23)
+        UPDATE_C_BZ_MASKED(24,25)
+        UPDATE_C_BZ_MASKED(26,27)
+        UPDATE_C_BZ_MASKED(28,29)
+        UPDATE_C_BZ_MASKED(30,31)
+
     LABEL(END)
 
     VZEROUPPER()
@@ -379,14 +462,18 @@ void bli_dgemm_skx_asm_16x14
           [beta]      "m" (beta),
           [c]         "m" (c),
           [rs_c]      "m" (rs_c),
-          [cs_c]      "m" (cs_c)
+          [cs_c]      "m" (cs_c),
+          [m]         "m" (m_),
+          [n]         "m" (n_),
+          [mask0]     "m" (mask0),
+          [mask1]     "m" (mask1)
         : // register clobber list
           "rax", "rbx", "rcx", "rdx", "rdi", "rsi", "r8", "r9", "r10", "r11", "r12",
           "r13", "r14", "r15", "zmm0", "zmm1", "zmm2", "zmm3", "zmm4", "zmm5",
           "zmm6", "zmm7", "zmm8", "zmm9", "zmm10", "zmm11", "zmm12", "zmm13",
           "zmm14", "zmm15", "zmm16", "zmm17", "zmm18", "zmm19", "zmm20", "zmm21",
           "zmm22", "zmm23", "zmm24", "zmm25", "zmm26", "zmm27", "zmm28", "zmm29",
-          "zmm30", "zmm31", "memory"
+          "zmm30", "zmm31", "k1", "k2", "memory"
     )
 
     GEMM_UKR_FLUSH_CT( d );
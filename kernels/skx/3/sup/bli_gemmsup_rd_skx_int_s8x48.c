@@ -0,0 +1,265 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrc:
+	 --------        ------        | | | | | | | |
+	 --------        ------        | | | | | | | |
+	 --------   +=   ------ ...    | | | | | | | |
+	 --------        ------        | | | | | | | |
+	 --------        ------            :
+	 --------        ------            :
+
+   Assumptions:
+   - C is row-stored and B is column-stored;
+   - A is row-stored;
+   - m0 and n0 are at most MR and NR, respectively, within each tile.
+   Therefore, this (r)ow-preferential kernel is well-suited for contiguous
+   vector loads on A and B along the k dimension, with each element of C
+   computed as a (d)ot product that is reduced at the end of the k loop.
+
+   Each 8x48 tile of C is computed as a sequence of 4x4 blocks. The k edge
+   is handled with masked loads, while the m and n edges are handled by
+   clamping the row/column pointers of A and B to the last valid row/column
+   (so that no out-of-bounds memory is read) and writing back only the
+   valid elements of each block. C may be stored with any strides. If A is
+   not row-stored or B is not column-stored, the rv kernel is used instead.
+*/
+
+#define MR 8
+#define NR 48
+
+// Accumulate the dot products for column j of the 4x4 block into the
+// named accumulators c0j..c3j. (Named variables, unlike an array, are kept
+// in registers by gcc.)
+#define DOT_COL( j, load ) \
+	bv = load( bp[ j ] + l ); \
+	c0##j = _mm512_fmadd_ps( a0, bv, c0##j ); \
+	c1##j = _mm512_fmadd_ps( a1, bv, c1##j ); \
+	c2##j = _mm512_fmadd_ps( a2, bv, c2##j ); \
+	c3##j = _mm512_fmadd_ps( a3, bv, c3##j );
+
+#define DOT_STEP( load ) \
+	a0 = load( ap[ 0 ] + l ); \
+	a1 = load( ap[ 1 ] + l ); \
+	a2 = load( ap[ 2 ] + l ); \
+	a3 = load( ap[ 3 ] + l ); \
+	DOT_COL( 0, load ) DOT_COL( 1, load ) DOT_COL( 2, load ) DOT_COL( 3, load )
+
+#define REDUCE_ROW( i ) \
+	ab[ i ][ 0 ] = _mm512_reduce_add_ps( c##i##0 ); \
+	ab[ i ][ 1 ] = _mm512_reduce_add_ps( c##i##1 ); \
+	ab[ i ][ 2 ] = _mm512_reduce_add_ps( c##i##2 ); \
+	ab[ i ][ 3 ] = _mm512_reduce_add_ps( c##i##3 );
+
+static void bli_sgemmsup_rd_skx_int_4x4
+     (
+             dim_t   mr,
+             dim_t   nr,
+             dim_t   k,
+       const float* alpha,
+       const float* a, inc_t rs_a,
+       const float* b, inc_t cs_b,
+       const float* beta,
+             float* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const float* ap[ 4 ];
+	const float* bp[ 4 ];
+	float        ab[ 4 ][ 4 ];
+
+	__m512 c00 = _mm512_setzero_ps(), c01 = c00, c02 = c00, c03 = c00;
+	__m512 c10 = c00, c11 = c00, c12 = c00, c13 = c00;
+	__m512 c20 = c00, c21 = c00, c22 = c00, c23 = c00;
+	__m512 c30 = c00, c31 = c00, c32 = c00, c33 = c00;
+	__m512 a0, a1, a2, a3, bv;
+
+	for ( dim_t i = 0; i < 4; ++i ) ap[ i ] = a + bli_min( i, mr - 1 )*rs_a;
+	for ( dim_t j = 0; j < 4; ++j ) bp[ j ] = b + bli_min( j, nr - 1 )*cs_b;
+
+	dim_t l = 0;
+
+	for ( ; l + 16 <= k; l += 16 )
+	{
+		DOT_STEP( _mm512_loadu_ps )
+	}
+
+	if ( l < k )
+	{
+		const __mmask16 mask = ( __mmask16 )( 0xFFFF >> ( 16 - ( k - l ) ) );
+
+		#define MASKED_LOAD( p ) _mm512_maskz_loadu_ps( mask, p )
+		DOT_STEP( MASKED_LOAD )
+		#undef MASKED_LOAD
+	}
+
+	REDUCE_ROW( 0 ) REDUCE_ROW( 1 ) REDUCE_ROW( 2 ) REDUCE_ROW( 3 )
+
+	// If beta is zero, C must not be read, since it may contain NaN or Inf.
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+		for ( dim_t j = 0; j < nr; ++j )
+			c[ i*rs_c + j*cs_c ] = *alpha * ab[ i ][ j ];
+	}
+	else
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+		for ( dim_t j = 0; j < nr; ++j )
+			c[ i*rs_c + j*cs_c ] = *alpha * ab[ i ][ j ]
+			                     + *beta  * c[ i*rs_c + j*cs_c ];
+	}
+}
+
+static void bli_sgemmsup_rd_skx_int_8x48
+     (
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const float*    alpha,
+       const float*    a, inc_t rs_a,
+       const float*    b, inc_t cs_b,
+       const float*    beta,
+             float*    c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data
+     )
+{
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		const dim_t   mr_cur = bli_min( MR, m0 - i );
+		const float* ai     = a + ( i / MR )*ps_a;
+		      float* ci     = c + i*rs_c;
+
+		for ( dim_t j = 0; j < n0; j += NR )
+		{
+			const dim_t   nr_cur = bli_min( NR, n0 - j );
+			const float* bj     = b + ( j / NR )*ps_b;
+			      float* cij    = ci + j*cs_c;
+
+			for ( dim_t ii = 0; ii < mr_cur; ii += 4 )
+			for ( dim_t jj = 0; jj < nr_cur; jj += 4 )
+			{
+				bli_sgemmsup_rd_skx_int_4x4
+				(
+				  bli_min( 4, mr_cur - ii ),
+				  bli_min( 4, nr_cur - jj ),
+				  k0, alpha,
+				  ai + ii*rs_a, rs_a,
+				  bj + jj*cs_b, cs_b,
+				  beta,
+				  cij + ii*rs_c + jj*cs_c, rs_c, cs_c
+				);
+			}
+		}
+	}
+}
+
+void bli_sgemmsup_rd_skx_int_8x48m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	if ( cs_a0 != 1 || rs_b0 != 1 )
+	{
+		bli_sgemmsup_rv_skx_int_8x48m
+		(
+		  conja, conjb, m0, n0, k0,
+		  alpha, a, rs_a0, cs_a0, b, rs_b0, cs_b0,
+		  beta, c, rs_c0, cs_c0, data, cntx
+		);
+		return;
+	}
+
+	bli_sgemmsup_rd_skx_int_8x48
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0,
+	  b, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
+void bli_sgemmsup_rd_skx_int_8x48n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	if ( cs_a0 != 1 || rs_b0 != 1 )
+	{
+		bli_sgemmsup_rv_skx_int_8x48n
+		(
+		  conja, conjb, m0, n0, k0,
+		  alpha, a, rs_a0, cs_a0, b, rs_b0, cs_b0,
+		  beta, c, rs_c0, cs_c0, data, cntx
+		);
+		return;
+	}
+
+	bli_sgemmsup_rd_skx_int_8x48
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0,
+	  b, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
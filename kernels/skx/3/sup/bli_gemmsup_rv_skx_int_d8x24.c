@@ -0,0 +1,338 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrr:
+	 --------        ------        --------
+	 --------        ------        --------
+	 --------   +=   ------ ...    --------
+	 --------        ------        --------
+	 --------        ------            :
+	 --------        ------            :
+
+   rcr:
+	 --------        | | | |       --------
+	 --------        | | | |       --------
+	 --------   +=   | | | | ...   --------
+	 --------        | | | |       --------
+	 --------        | | | |           :
+	 --------        | | | |           :
+
+   Assumptions:
+   - B is row-stored;
+   - A is row- or column-stored;
+   - m0 and n0 are at most MR and NR, respectively, within each tile.
+   Therefore, this (r)ow-preferential kernel is well-suited for contiguous
+   (v)ector loads on B and single-element broadcasts from A.
+
+   Each 8x24 tile of C is held in 24 zmm accumulators (three per row). Edge
+   tiles are not dispatched to smaller kernels; instead, the number of rows
+   and the number of active vectors per row are compile-time constants of
+   an inlined tile function, and the last active vector in each row is
+   loaded and stored under a mask. C may be stored with any strides; when
+   it is not row-stored, the tile is written via masked gather/scatter. If
+   B is not row-stored, its rows are gathered rather than loaded.
+
+   Because the tile function handles both m and n edges, the m- and
+   n-millikernels share a single loop nest over micropanels of A and B.
+*/
+
+#define MR 8
+#define NR 24
+
+// The accumulators are declared as named variables, rather than as an
+// array, since gcc otherwise keeps the array in memory (__m512d may alias
+// the elements of A) and spills every accumulator on each iteration of the
+// k loop. Since mr and nv are compile-time constants at every call site,
+// the conditionals below are resolved by the compiler.
+
+#define DECL_ROW( i ) \
+	__m512d c##i##0 = _mm512_setzero_pd(); \
+	__m512d c##i##1 = _mm512_setzero_pd(); \
+	__m512d c##i##2 = _mm512_setzero_pd();
+
+#define FMA_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		av = _mm512_set1_pd( al[ i*rs_a ] ); \
+		             c##i##0 = _mm512_fmadd_pd( av, b0, c##i##0 ); \
+		if ( 1 < nv ) c##i##1 = _mm512_fmadd_pd( av, b1, c##i##1 ); \
+		if ( 2 < nv ) c##i##2 = _mm512_fmadd_pd( av, b2, c##i##2 ); \
+	}
+
+#define UPDATE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		             UPDATE_VEC( i, c##i##0, 0 ); \
+		if ( 1 < nv ) UPDATE_VEC( i, c##i##1, 1 ); \
+		if ( 2 < nv ) UPDATE_VEC( i, c##i##2, 2 ); \
+	}
+
+static inline __attribute__((always_inline)) void bli_dgemmsup_rv_skx_int_tile
+     (
+       const dim_t    mr,
+       const dim_t    nv,
+             __mmask8 mask,
+             dim_t    k,
+       const double*  alpha,
+       const double*  a, inc_t rs_a, inc_t cs_a,
+       const double*  b, inc_t rs_b, inc_t cs_b,
+       const double*  beta,
+             double*  c, inc_t rs_c, inc_t cs_c
+     )
+{
+	DECL_ROW( 0 ) DECL_ROW( 1 ) DECL_ROW( 2 ) DECL_ROW( 3 )
+	DECL_ROW( 4 ) DECL_ROW( 5 ) DECL_ROW( 6 ) DECL_ROW( 7 )
+
+	__m512d b0, b1, b2;
+	__m512d av;
+
+	// Only the last active vector of each row of B and C is masked.
+	const __mmask8 m0 = ( nv == 1 ? mask : 0xFF );
+	const __mmask8 m1 = ( nv == 2 ? mask : 0xFF );
+	const __mmask8 m2 = ( nv == 3 ? mask : 0xFF );
+
+	// Prefetch the rows of C, if C is row-stored.
+	if ( cs_c == 1 )
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+			_mm_prefetch( ( const char* )( c + i*rs_c ), _MM_HINT_T0 );
+	}
+
+	if ( cs_b == 1 )
+	{
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const double* restrict al = a + l*cs_a;
+			const double* restrict bl = b + l*rs_b;
+
+			             b0 = _mm512_maskz_loadu_pd( m0, bl +  0 );
+			if ( 1 < nv ) b1 = _mm512_maskz_loadu_pd( m1, bl +  8 );
+			if ( 2 < nv ) b2 = _mm512_maskz_loadu_pd( m2, bl + 16 );
+
+			FMA_ROW( 0 ) FMA_ROW( 1 ) FMA_ROW( 2 ) FMA_ROW( 3 )
+			FMA_ROW( 4 ) FMA_ROW( 5 ) FMA_ROW( 6 ) FMA_ROW( 7 )
+		}
+	}
+	else
+	{
+		const __m512i vidx = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+		                                         _mm512_set1_epi64( cs_b ) );
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const double* restrict al = a + l*cs_a;
+			const double* restrict bl = b + l*rs_b;
+
+			             b0 = _mm512_mask_i64gather_pd( _mm512_setzero_pd(), m0, vidx, bl +  0*cs_b, 8 );
+			if ( 1 < nv ) b1 = _mm512_mask_i64gather_pd( _mm512_setzero_pd(), m1, vidx, bl +  8*cs_b, 8 );
+			if ( 2 < nv ) b2 = _mm512_mask_i64gather_pd( _mm512_setzero_pd(), m2, vidx, bl + 16*cs_b, 8 );
+
+			FMA_ROW( 0 ) FMA_ROW( 1 ) FMA_ROW( 2 ) FMA_ROW( 3 )
+			FMA_ROW( 4 ) FMA_ROW( 5 ) FMA_ROW( 6 ) FMA_ROW( 7 )
+		}
+	}
+
+	const __m512d alphav = _mm512_set1_pd( *alpha );
+	const __m512d betav  = _mm512_set1_pd( *beta );
+	const bool    beta0  = PASTEMAC(d,eq0)( *beta );
+
+	// If beta is zero, C must not be read, since it may contain NaN or Inf.
+	if ( cs_c == 1 )
+	{
+		#undef  UPDATE_VEC
+		#define UPDATE_VEC( i, cv, v ) \
+		{ \
+			double* restrict cp = c + i*rs_c + v*8; \
+			cv = _mm512_mul_pd( alphav, cv ); \
+			if ( !beta0 ) \
+				cv = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( m##v, cp ), cv ); \
+			_mm512_mask_storeu_pd( cp, m##v, cv ); \
+		}
+
+		UPDATE_ROW( 0 ) UPDATE_ROW( 1 ) UPDATE_ROW( 2 ) UPDATE_ROW( 3 )
+		UPDATE_ROW( 4 ) UPDATE_ROW( 5 ) UPDATE_ROW( 6 ) UPDATE_ROW( 7 )
+	}
+	else
+	{
+		const __m512i vidx = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+		                                         _mm512_set1_epi64( cs_c ) );
+
+		#undef  UPDATE_VEC
+		#define UPDATE_VEC( i, cv, v ) \
+		{ \
+			double* restrict cp = c + i*rs_c + v*8*cs_c; \
+			cv = _mm512_mul_pd( alphav, cv ); \
+			if ( !beta0 ) \
+				cv = _mm512_fmadd_pd( betav, _mm512_mask_i64gather_pd( _mm512_setzero_pd(), \
+				                                                       m##v, vidx, cp, 8 ), cv ); \
+			_mm512_mask_i64scatter_pd( cp, m##v, vidx, cv, 8 ); \
+		}
+
+		UPDATE_ROW( 0 ) UPDATE_ROW( 1 ) UPDATE_ROW( 2 ) UPDATE_ROW( 3 )
+		UPDATE_ROW( 4 ) UPDATE_ROW( 5 ) UPDATE_ROW( 6 ) UPDATE_ROW( 7 )
+	}
+}
+
+// Expand the tile function for each (mr,nv) pair so that the accumulators
+// can be kept in registers.
+#define TILE_CASE( mr, nv ) \
+	case ( mr - 1 )*3 + ( nv - 1 ): \
+		bli_dgemmsup_rv_skx_int_tile \
+		( \
+		  mr, nv, mask, k, alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c \
+		); \
+		break;
+
+static void bli_dgemmsup_rv_skx_int_tile_dispatch
+     (
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+       const double* alpha,
+       const double* a, inc_t rs_a, inc_t cs_a,
+       const double* b, inc_t rs_b, inc_t cs_b,
+       const double* beta,
+             double* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t    nv   = ( n + 7 ) / 8;
+	const __mmask8 mask = ( __mmask8 )( 0xFF >> ( nv*8 - n ) );
+
+	switch ( ( m - 1 )*3 + ( nv - 1 ) )
+	{
+		TILE_CASE( 1, 1 ) TILE_CASE( 1, 2 ) TILE_CASE( 1, 3 )
+		TILE_CASE( 2, 1 ) TILE_CASE( 2, 2 ) TILE_CASE( 2, 3 )
+		TILE_CASE( 3, 1 ) TILE_CASE( 3, 2 ) TILE_CASE( 3, 3 )
+		TILE_CASE( 4, 1 ) TILE_CASE( 4, 2 ) TILE_CASE( 4, 3 )
+		TILE_CASE( 5, 1 ) TILE_CASE( 5, 2 ) TILE_CASE( 5, 3 )
+		TILE_CASE( 6, 1 ) TILE_CASE( 6, 2 ) TILE_CASE( 6, 3 )
+		TILE_CASE( 7, 1 ) TILE_CASE( 7, 2 ) TILE_CASE( 7, 3 )
+		TILE_CASE( 8, 1 ) TILE_CASE( 8, 2 ) TILE_CASE( 8, 3 )
+	}
+}
+
+static void bli_dgemmsup_rv_skx_int_8x24
+     (
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const double*    alpha,
+       const double*    a, inc_t rs_a, inc_t cs_a,
+       const double*    b, inc_t rs_b, inc_t cs_b,
+       const double*    beta,
+             double*    c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data
+     )
+{
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		const dim_t   mr_cur = bli_min( MR, m0 - i );
+		const double* ai     = a + ( i / MR )*ps_a;
+		      double* ci     = c + i*rs_c;
+
+		for ( dim_t j = 0; j < n0; j += NR )
+		{
+			const dim_t   nr_cur = bli_min( NR, n0 - j );
+			const double* bj     = b + ( j / NR )*ps_b;
+			      double* cij    = ci + j*cs_c;
+
+			bli_dgemmsup_rv_skx_int_tile_dispatch
+			(
+			  mr_cur, nr_cur, k0, alpha,
+			  ai, rs_a, cs_a,
+			  bj, rs_b, cs_b,
+			  beta, cij, rs_c, cs_c
+			);
+		}
+	}
+}
+
+void bli_dgemmsup_rv_skx_int_8x24m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	bli_dgemmsup_rv_skx_int_8x24
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0, cs_a0,
+	  b, rs_b0, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
+void bli_dgemmsup_rv_skx_int_8x24n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	bli_dgemmsup_rv_skx_int_8x24
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0, cs_a0,
+	  b, rs_b0, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
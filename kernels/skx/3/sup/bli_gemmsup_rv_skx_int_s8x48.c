@@ -0,0 +1,369 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrr:
+	 --------        ------        --------
+	 --------        ------        --------
+	 --------   +=   ------ ...    --------
+	 --------        ------        --------
+	 --------        ------            :
+	 --------        ------            :
+
+   rcr:
+	 --------        | | | |       --------
+	 --------        | | | |       --------
+	 --------   +=   | | | | ...   --------
+	 --------        | | | |       --------
+	 --------        | | | |           :
+	 --------        | | | |           :
+
+   Assumptions:
+   - B is row-stored;
+   - A is row- or column-stored;
+   - m0 and n0 are at most MR and NR, respectively, within each tile.
+   Therefore, this (r)ow-preferential kernel is well-suited for contiguous
+   (v)ector loads on B and single-element broadcasts from A.
+
+   Each 8x48 tile of C is held in 24 zmm accumulators (three per row). Edge
+   tiles are not dispatched to smaller kernels; instead, the number of rows
+   and the number of active vectors per row are compile-time constants of
+   an inlined tile function, and the last active vector in each row is
+   loaded and stored under a mask. C may be stored with any strides; when
+   it is not row-stored, the tile is written via masked gather/scatter. If
+   B is not row-stored, its rows are gathered rather than loaded.
+
+   Because the tile function handles both m and n edges, the m- and
+   n-millikernels share a single loop nest over micropanels of A and B.
+*/
+
+#define MR 8
+#define NR 48
+
+// Gather (scatter) sixteen elements with stride inc using two eight-element
+// gathers (scatters) with 64-bit indices, so that 16*inc need not fit in 32
+// bits. vidx holds the indices { 0, inc, ..., 7*inc }.
+static inline __m512 bli_sgemmsup_rv_skx_int_gather
+     (
+             __mmask16 m,
+             __m512i   vidx,
+       const float*    p,
+             inc_t     inc
+     )
+{
+	const __m256 lo = _mm512_mask_i64gather_ps( _mm256_setzero_ps(), ( __mmask8 )m,
+	                                            vidx, p, 4 );
+	const __m256 hi = _mm512_mask_i64gather_ps( _mm256_setzero_ps(), ( __mmask8 )( m >> 8 ),
+	                                            vidx, p + 8*inc, 4 );
+
+	return _mm512_insertf32x8( _mm512_castps256_ps512( lo ), hi, 1 );
+}
+
+static inline void bli_sgemmsup_rv_skx_int_scatter
+     (
+             __mmask16 m,
+             __m512i   vidx,
+             float*    p,
+             inc_t     inc,
+             __m512    x
+     )
+{
+	_mm512_mask_i64scatter_ps( p, ( __mmask8 )m, vidx,
+	                           _mm512_castps512_ps256( x ), 4 );
+	_mm512_mask_i64scatter_ps( p + 8*inc, ( __mmask8 )( m >> 8 ), vidx,
+	                           _mm512_extractf32x8_ps( x, 1 ), 4 );
+}
+
+// The accumulators are declared as named variables rather than as an
+// array; see bli_gemmsup_rv_skx_int_d8x24.c.
+
+#define DECL_ROW( i ) \
+	__m512 c##i##0 = _mm512_setzero_ps(); \
+	__m512 c##i##1 = _mm512_setzero_ps(); \
+	__m512 c##i##2 = _mm512_setzero_ps();
+
+#define FMA_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		av = _mm512_set1_ps( al[ i*rs_a ] ); \
+		             c##i##0 = _mm512_fmadd_ps( av, b0, c##i##0 ); \
+		if ( 1 < nv ) c##i##1 = _mm512_fmadd_ps( av, b1, c##i##1 ); \
+		if ( 2 < nv ) c##i##2 = _mm512_fmadd_ps( av, b2, c##i##2 ); \
+	}
+
+#define UPDATE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		             UPDATE_VEC( i, c##i##0, 0 ); \
+		if ( 1 < nv ) UPDATE_VEC( i, c##i##1, 1 ); \
+		if ( 2 < nv ) UPDATE_VEC( i, c##i##2, 2 ); \
+	}
+
+static inline __attribute__((always_inline)) void bli_sgemmsup_rv_skx_int_tile
+     (
+       const dim_t     mr,
+       const dim_t     nv,
+             __mmask16 mask,
+             dim_t     k,
+       const float*    alpha,
+       const float*    a, inc_t rs_a, inc_t cs_a,
+       const float*    b, inc_t rs_b, inc_t cs_b,
+       const float*    beta,
+             float*    c, inc_t rs_c, inc_t cs_c
+     )
+{
+	DECL_ROW( 0 ) DECL_ROW( 1 ) DECL_ROW( 2 ) DECL_ROW( 3 )
+	DECL_ROW( 4 ) DECL_ROW( 5 ) DECL_ROW( 6 ) DECL_ROW( 7 )
+
+	__m512 b0, b1, b2;
+	__m512 av;
+
+	// Only the last active vector of each row of B and C is masked.
+	const __mmask16 m0 = ( nv == 1 ? mask : 0xFFFF );
+	const __mmask16 m1 = ( nv == 2 ? mask : 0xFFFF );
+	const __mmask16 m2 = ( nv == 3 ? mask : 0xFFFF );
+
+	// Prefetch the rows of C, if C is row-stored.
+	if ( cs_c == 1 )
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+			_mm_prefetch( ( const char* )( c + i*rs_c ), _MM_HINT_T0 );
+	}
+
+	if ( cs_b == 1 )
+	{
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const float* restrict al = a + l*cs_a;
+			const float* restrict bl = b + l*rs_b;
+
+			             b0 = _mm512_maskz_loadu_ps( m0, bl +  0 );
+			if ( 1 < nv ) b1 = _mm512_maskz_loadu_ps( m1, bl + 16 );
+			if ( 2 < nv ) b2 = _mm512_maskz_loadu_ps( m2, bl + 32 );
+
+			FMA_ROW( 0 ) FMA_ROW( 1 ) FMA_ROW( 2 ) FMA_ROW( 3 )
+			FMA_ROW( 4 ) FMA_ROW( 5 ) FMA_ROW( 6 ) FMA_ROW( 7 )
+		}
+	}
+	else
+	{
+		const __m512i vidx = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+		                                         _mm512_set1_epi64( cs_b ) );
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const float* restrict al = a + l*cs_a;
+			const float* restrict bl = b + l*rs_b;
+
+			             b0 = bli_sgemmsup_rv_skx_int_gather( m0, vidx, bl +  0*cs_b, cs_b );
+			if ( 1 < nv ) b1 = bli_sgemmsup_rv_skx_int_gather( m1, vidx, bl + 16*cs_b, cs_b );
+			if ( 2 < nv ) b2 = bli_sgemmsup_rv_skx_int_gather( m2, vidx, bl + 32*cs_b, cs_b );
+
+			FMA_ROW( 0 ) FMA_ROW( 1 ) FMA_ROW( 2 ) FMA_ROW( 3 )
+			FMA_ROW( 4 ) FMA_ROW( 5 ) FMA_ROW( 6 ) FMA_ROW( 7 )
+		}
+	}
+
+	const __m512 alphav = _mm512_set1_ps( *alpha );
+	const __m512 betav  = _mm512_set1_ps( *beta );
+	const bool   beta0  = PASTEMAC(s,eq0)( *beta );
+
+	// If beta is zero, C must not be read, since it may contain NaN or Inf.
+	if ( cs_c == 1 )
+	{
+		#undef  UPDATE_VEC
+		#define UPDATE_VEC( i, cv, v ) \
+		{ \
+			float* restrict cp = c + i*rs_c + v*16; \
+			cv = _mm512_mul_ps( alphav, cv ); \
+			if ( !beta0 ) \
+				cv = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( m##v, cp ), cv ); \
+			_mm512_mask_storeu_ps( cp, m##v, cv ); \
+		}
+
+		UPDATE_ROW( 0 ) UPDATE_ROW( 1 ) UPDATE_ROW( 2 ) UPDATE_ROW( 3 )
+		UPDATE_ROW( 4 ) UPDATE_ROW( 5 ) UPDATE_ROW( 6 ) UPDATE_ROW( 7 )
+	}
+	else
+	{
+		const __m512i vidx = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+		                                         _mm512_set1_epi64( cs_c ) );
+
+		#undef  UPDATE_VEC
+		#define UPDATE_VEC( i, cv, v ) \
+		{ \
+			float* restrict cp = c + i*rs_c + v*16*cs_c; \
+			cv = _mm512_mul_ps( alphav, cv ); \
+			if ( !beta0 ) \
+				cv = _mm512_fmadd_ps( betav, \
+				     bli_sgemmsup_rv_skx_int_gather( m##v, vidx, cp, cs_c ), cv ); \
+			bli_sgemmsup_rv_skx_int_scatter( m##v, vidx, cp, cs_c, cv ); \
+		}
+
+		UPDATE_ROW( 0 ) UPDATE_ROW( 1 ) UPDATE_ROW( 2 ) UPDATE_ROW( 3 )
+		UPDATE_ROW( 4 ) UPDATE_ROW( 5 ) UPDATE_ROW( 6 ) UPDATE_ROW( 7 )
+	}
+}
+
+// Expand the tile function for each (mr,nv) pair so that the accumulators
+// can be kept in registers.
+#define TILE_CASE( mr, nv ) \
+	case ( mr - 1 )*3 + ( nv - 1 ): \
+		bli_sgemmsup_rv_skx_int_tile \
+		( \
+		  mr, nv, mask, k, alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c \
+		); \
+		break;
+
+static void bli_sgemmsup_rv_skx_int_tile_dispatch
+     (
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+       const float* alpha,
+       const float* a, inc_t rs_a, inc_t cs_a,
+       const float* b, inc_t rs_b, inc_t cs_b,
+       const float* beta,
+             float* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t    nv   = ( n + 15 ) / 16;
+	const __mmask16 mask = ( __mmask16 )( 0xFFFF >> ( nv*16 - n ) );
+
+	switch ( ( m - 1 )*3 + ( nv - 1 ) )
+	{
+		TILE_CASE( 1, 1 ) TILE_CASE( 1, 2 ) TILE_CASE( 1, 3 )
+		TILE_CASE( 2, 1 ) TILE_CASE( 2, 2 ) TILE_CASE( 2, 3 )
+		TILE_CASE( 3, 1 ) TILE_CASE( 3, 2 ) TILE_CASE( 3, 3 )
+		TILE_CASE( 4, 1 ) TILE_CASE( 4, 2 ) TILE_CASE( 4, 3 )
+		TILE_CASE( 5, 1 ) TILE_CASE( 5, 2 ) TILE_CASE( 5, 3 )
+		TILE_CASE( 6, 1 ) TILE_CASE( 6, 2 ) TILE_CASE( 6, 3 )
+		TILE_CASE( 7, 1 ) TILE_CASE( 7, 2 ) TILE_CASE( 7, 3 )
+		TILE_CASE( 8, 1 ) TILE_CASE( 8, 2 ) TILE_CASE( 8, 3 )
+	}
+}
+
+static void bli_sgemmsup_rv_skx_int_8x48
+     (
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const float*    alpha,
+       const float*    a, inc_t rs_a, inc_t cs_a,
+       const float*    b, inc_t rs_b, inc_t cs_b,
+       const float*    beta,
+             float*    c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data
+     )
+{
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		const dim_t   mr_cur = bli_min( MR, m0 - i );
+		const float* ai     = a + ( i / MR )*ps_a;
+		      float* ci     = c + i*rs_c;
+
+		for ( dim_t j = 0; j < n0; j += NR )
+		{
+			const dim_t   nr_cur = bli_min( NR, n0 - j );
+			const float* bj     = b + ( j / NR )*ps_b;
+			      float* cij    = ci + j*cs_c;
+
+			bli_sgemmsup_rv_skx_int_tile_dispatch
+			(
+			  mr_cur, nr_cur, k0, alpha,
+			  ai, rs_a, cs_a,
+			  bj, rs_b, cs_b,
+			  beta, cij, rs_c, cs_c
+			);
+		}
+	}
+}
+
+void bli_sgemmsup_rv_skx_int_8x48m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	bli_sgemmsup_rv_skx_int_8x48
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0, cs_a0,
+	  b, rs_b0, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
+void bli_sgemmsup_rv_skx_int_8x48n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	bli_sgemmsup_rv_skx_int_8x48
+	(
+	  m0, n0, k0, alpha,
+	  a, rs_a0, cs_a0,
+	  b, rs_b0, cs_b0,
+	  beta, c, rs_c0, cs_c0, data
+	);
+}
+
@@ -39,3 +39,21 @@ GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
 
+
+// -- level-3 sup --------------------------------------------------------------
+
+// gemmsup_rv
+
+GEMMSUP_KER_PROT( float,   s, gemmsup_rv_skx_int_8x48m )
+GEMMSUP_KER_PROT( float,   s, gemmsup_rv_skx_int_8x48n )
+
+GEMMSUP_KER_PROT( double,  d, gemmsup_rv_skx_int_8x24m )
+GEMMSUP_KER_PROT( double,  d, gemmsup_rv_skx_int_8x24n )
+
+// gemmsup_rd
+
+GEMMSUP_KER_PROT( float,   s, gemmsup_rd_skx_int_8x48m )
+GEMMSUP_KER_PROT( float,   s, gemmsup_rd_skx_int_8x48n )
+
+GEMMSUP_KER_PROT( double,  d, gemmsup_rd_skx_int_8x24m )
+GEMMSUP_KER_PROT( double,  d, gemmsup_rd_skx_int_8x24n )
@@ -0,0 +1,120 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "blis.h"
+
+// NOTE: The complex rv kernels in this directory do not implement
+// conjugation of A or B. The millikernels (3x8m, 3x8n, 3x4m, 3x4n) defer
+// to the kernels below whenever either operand needs to be conjugated.
+// As with bli_gemmsup_r_haswell_ref_dMx1.c, the reference code is inlined
+// here so that it is compiled as part of the zen kernel set and can thus be
+// called regardless of which subconfiguration is using these kernels.
+//
+// Unlike the framework's reference gemmsup kernel, these kernels honor the
+// panel strides of A and B stored in the auxinfo_t, and so they may be
+// called with m and n larger than MR and NR when A or B is packed.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, mr, nr ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, inc_t rs_a, inc_t cs_a, \
+       const void*      b0, inc_t rs_b, inc_t cs_b, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx \
+     ) \
+{ \
+	const ctype* alpha = alpha0; \
+	const ctype* a     = a0; \
+	const ctype* b     = b0; \
+	const ctype* beta  = beta0; \
+	      ctype* c     = c0; \
+\
+	const inc_t  ps_a  = bli_auxinfo_ps_a( data ); \
+	const inc_t  ps_b  = bli_auxinfo_ps_b( data ); \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		      ctype* ci = &c[ i*rs_c ]; \
+		const ctype* ai = &a[ ( i / mr )*ps_a + ( i % mr )*rs_a ]; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			      ctype* cij = &ci[ j*cs_c ]; \
+			const ctype* bj  = &b[ ( j / nr )*ps_b + ( j % nr )*cs_b ]; \
+			ctype        ab; \
+\
+			PASTEMAC(ch,set0s)( ab ); \
+\
+			/* Perform a dot product to update the (i,j) element of c. */ \
+			for ( dim_t l = 0; l < k; ++l ) \
+			{ \
+				ctype ail, blj; \
+\
+				PASTEMAC(ch,copycjs)( conja, ai[ l*cs_a ], ail ); \
+				PASTEMAC(ch,copycjs)( conjb, bj[ l*rs_b ], blj ); \
+\
+				PASTEMAC(ch,dots)( ail, blj, ab ); \
+			} \
+\
+			/* If beta is one, add ab into c. If beta is zero, overwrite c
+			   with the result in ab. Otherwise, scale by beta and accumulate
+			   ab to c. */ \
+			if ( PASTEMAC(ch,eq1)( *beta ) ) \
+			{ \
+				PASTEMAC(ch,axpys)( *alpha, ab, *cij ); \
+			} \
+			else if ( PASTEMAC(ch,eq0)( *beta ) ) \
+			{ \
+				PASTEMAC(ch,scal2s)( *alpha, ab, *cij ); \
+			} \
+			else \
+			{ \
+				PASTEMAC(ch,axpbys)( *alpha, ab, *beta, *cij ); \
+			} \
+		} \
+	} \
+}
+
+GENTFUNC( scomplex, c, gemmsup_r_zen_ref_3x8, 3, 8 )
+GENTFUNC( dcomplex, z, gemmsup_r_zen_ref_3x4, 3, 4 )
+
@@ -90,18 +90,18 @@
 
 void bli_cgemmsup_rv_zen_asm_2x8
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -554,18 +554,18 @@ void bli_cgemmsup_rv_zen_asm_2x8
 
 void bli_cgemmsup_rv_zen_asm_1x8
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -916,18 +916,18 @@ void bli_cgemmsup_rv_zen_asm_1x8
 
 void bli_cgemmsup_rv_zen_asm_2x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1292,18 +1292,18 @@ void bli_cgemmsup_rv_zen_asm_2x4
 
 void bli_cgemmsup_rv_zen_asm_1x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1610,18 +1610,18 @@ void bli_cgemmsup_rv_zen_asm_1x4
 
 void bli_cgemmsup_rv_zen_asm_2x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-	   auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1989,18 +1989,18 @@ void bli_cgemmsup_rv_zen_asm_2x2
 
 void bli_cgemmsup_rv_zen_asm_1x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
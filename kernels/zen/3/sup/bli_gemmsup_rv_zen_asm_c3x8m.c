@@ -113,29 +113,42 @@
 */
 void bli_cgemmsup_rv_zen_asm_3x8m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	// The kernels below do not implement conjugation of A or B, so defer
+	// to the reference kernel if either operand needs to be conjugated.
+	if ( bli_is_conj( conja ) || bli_is_conj( conjb ) )
+	{
+		bli_cgemmsup_r_zen_ref_3x8
+		(
+		  conja, conjb, m0, n0, k0,
+		  alpha, a, rs_a0, cs_a0, b, rs_b0, cs_b0,
+		  beta, c, rs_c0, cs_c0, data, cntx
+		);
+		return;
+	}
+
 	uint64_t n_left = n0 % 8;
 
 	// First check whether this is a edge case in the n dimension. If so,
 	// dispatch other 3x?m kernels, as needed.
 	if (n_left )
 	{
-		scomplex*  cij = c;
-		scomplex*  bj  = b;
-		scomplex*  ai  = a;
+		      scomplex* cij = ( scomplex* )c;
+		const scomplex* bj  = ( const scomplex* )b;
+		const scomplex* ai  = ( const scomplex* )a;
 
 		if ( 4 <= n_left )
 		{
@@ -163,12 +176,44 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 		}
 		if ( 1 == n_left )
 		{
-			bli_cgemv_ex
-			(
-			  BLIS_NO_TRANSPOSE, conjb, m0, k0,
-			  alpha, ai, rs_a0, cs_a0, bj, rs_b0,
-			  beta, cij, rs_c0, cntx, NULL
-			);
+			dim_t ps_a0 = bli_auxinfo_ps_a( data );
+
+			if ( ps_a0 == 3 * rs_a0 )
+			{
+				// Since A is not packed, we can use one gemv.
+				bli_cgemv_ex
+				(
+				  BLIS_NO_TRANSPOSE, conjb, m0, k0,
+				  alpha, ai, rs_a0, cs_a0, bj, rs_b0,
+				  beta, cij, rs_c0, cntx, NULL
+				);
+			}
+			else
+			{
+				const dim_t mr = 3;
+
+				// Since A is packed into row panels, we must use a loop over
+				// gemv.
+				dim_t m_iter = ( m0 + mr - 1 ) / mr;
+				dim_t m_left =   m0            % mr;
+
+				const scomplex* ai_ii  = ai;
+				      scomplex* cij_ii = cij;
+
+				for ( dim_t ii = 0; ii < m_iter; ii += 1 )
+				{
+					dim_t mr_cur = ( bli_is_not_edge_f( ii, m_iter, m_left )
+					                 ? mr : m_left );
+
+					bli_cgemv_ex
+					(
+					  BLIS_NO_TRANSPOSE, conjb, mr_cur, k0,
+					  alpha, ai_ii, rs_a0, cs_a0, bj, rs_b0,
+					  beta, cij_ii, rs_c0, cntx, NULL
+					);
+					cij_ii += mr*rs_c0; ai_ii += ps_a0;
+				}
+			}
 		}
 
 		return;
@@ -193,6 +238,10 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
@@ -705,8 +754,8 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X8I)                    // iterate again if ii != 0.
@@ -721,6 +770,7 @@ void bli_cgemmsup_rv_zen_asm_3x8m
       [k_left] "m" (k_left),
       [a]      "m" (a),
       [rs_a]   "m" (rs_a),
+      [ps_a8]  "m" (ps_a8),
       [cs_a]   "m" (cs_a),
       [b]      "m" (b),
       [rs_b]   "m" (rs_b),
@@ -750,18 +800,18 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 		const dim_t      nr_cur = 8;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( const scomplex* )a + m_iter*ps_a;
+		const scomplex* bj  = ( const scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x8,
 		  bli_cgemmsup_rv_zen_asm_2x8,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
@@ -778,18 +828,18 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 
 void bli_cgemmsup_rv_zen_asm_3x4m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -811,6 +861,10 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
@@ -1196,8 +1250,8 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X4I)                    // iterate again if ii != 0.
@@ -1212,6 +1266,7 @@ void bli_cgemmsup_rv_zen_asm_3x4m
       [k_left] "m" (k_left),
       [a]      "m" (a),
       [rs_a]   "m" (rs_a),
+      [ps_a8]  "m" (ps_a8),
       [cs_a]   "m" (cs_a),
       [b]      "m" (b),
       [rs_b]   "m" (rs_b),
@@ -1241,18 +1296,18 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 		const dim_t      nr_cur = 4;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( const scomplex* )a + m_iter*ps_a;
+		const scomplex* bj  = ( const scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x4,
 		  bli_cgemmsup_rv_zen_asm_2x4,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
@@ -1267,18 +1322,18 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 
 void bli_cgemmsup_rv_zen_asm_3x2m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1300,6 +1355,10 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
@@ -1684,8 +1743,8 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X2I)                    // iterate again if ii != 0.
@@ -1700,6 +1759,7 @@ void bli_cgemmsup_rv_zen_asm_3x2m
       [k_left] "m" (k_left),
       [a]      "m" (a),
       [rs_a]   "m" (rs_a),
+      [ps_a8]  "m" (ps_a8),
       [cs_a]   "m" (cs_a),
       [b]      "m" (b),
       [rs_b]   "m" (rs_b),
@@ -1729,18 +1789,18 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 		const dim_t      nr_cur = 2;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( const scomplex* )a + m_iter*ps_a;
+		const scomplex* bj  = ( const scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x2,
 		  bli_cgemmsup_rv_zen_asm_2x2,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
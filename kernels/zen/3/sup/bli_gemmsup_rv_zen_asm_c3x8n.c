@@ -70,30 +70,49 @@
 */
 void bli_cgemmsup_rv_zen_asm_3x8n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const scomplex* restrict alpha = alpha0;
+	const scomplex* restrict a     = a0;
+	const scomplex* restrict b     = b0;
+	const scomplex* restrict beta  = beta0;
+	      scomplex* restrict c     = c0;
+
+	// The kernels below do not implement conjugation of A or B, so defer
+	// to the reference kernel if either operand needs to be conjugated.
+	if ( bli_is_conj( conja ) || bli_is_conj( conjb ) )
+	{
+		bli_cgemmsup_r_zen_ref_3x8
+		(
+		  conja, conjb, m0, n0, k0,
+		  alpha0, a0, rs_a0, cs_a0, b0, rs_b0, cs_b0,
+		  beta0, c0, rs_c0, cs_c0, data, cntx
+		);
+		return;
+	}
+
 	uint64_t m_left = m0 % 3;
 	if ( m_left )
 	{
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 			NULL,
 			bli_cgemmsup_rv_zen_asm_1x8n,
 			bli_cgemmsup_rv_zen_asm_2x8n,
 		};
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 		ker_fp
 		(
 			conja, conjb, m_left, n0, k0,
@@ -116,10 +135,11 @@ void bli_cgemmsup_rv_zen_asm_3x8n
 	uint64_t rs_a   = rs_a0;
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
 
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
@@ -129,11 +149,12 @@ void bli_cgemmsup_rv_zen_asm_3x8n
 	__m256 ymm4, ymm5, ymm6, ymm7;
 	__m256 ymm8, ymm9, ymm10, ymm11;
 	__m256 ymm12, ymm13, ymm14, ymm15;
-	__m128 xmm0, xmm3;
+	__m128 xmm0 = _mm_setzero_ps();
+	__m128 xmm3 = _mm_setzero_ps();
 
-	scomplex *tA = a;
-	float *tAimag = &a->imag;
-	scomplex *tB = b;
+	const scomplex *tA = a;
+	const float *tAimag = &a->imag;
+	const scomplex *tB = b;
 	scomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 8; n_iter++)
 	{
@@ -156,12 +177,11 @@ void bli_cgemmsup_rv_zen_asm_3x8n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*8;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*8;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -479,9 +499,9 @@ void bli_cgemmsup_rv_zen_asm_3x8n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		scomplex* restrict cij = c + j_edge*cs_c;
-		scomplex* restrict ai  = a;
-		scomplex* restrict bj  = b + n_iter*8;
+		      scomplex* cij = ( scomplex* )c + j_edge*cs_c;
+		const scomplex* ai  = ( const scomplex* )a;
+		const scomplex* bj  = ( const scomplex* )b + n_iter*ps_b;
 
 		if ( 4 <= n_left )
 		{
@@ -524,20 +544,26 @@ void bli_cgemmsup_rv_zen_asm_3x8n
 
 void bli_cgemmsup_rv_zen_asm_2x8n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const scomplex* restrict alpha = alpha0;
+	const scomplex* restrict a     = a0;
+	const scomplex* restrict b     = b0;
+	const scomplex* restrict beta  = beta0;
+	      scomplex* restrict c     = c0;
+
 	//void*    a_next = bli_auxinfo_next_a( data );
 	//void*    b_next = bli_auxinfo_next_b( data );
 
@@ -552,10 +578,12 @@ void bli_cgemmsup_rv_zen_asm_2x8n
 	uint64_t rs_a   = rs_a0;
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
+
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
@@ -563,11 +591,12 @@ void bli_cgemmsup_rv_zen_asm_2x8n
 	__m256 ymm0, ymm1, ymm2, ymm3;
 	__m256 ymm4, ymm5, ymm6, ymm7;
 	__m256 ymm8, ymm9, ymm10, ymm11;
-	__m128 xmm0, xmm3;
+	__m128 xmm0 = _mm_setzero_ps();
+	__m128 xmm3 = _mm_setzero_ps();
 
-	scomplex *tA = a;
-	float *tAimag = &a->imag;
-	scomplex *tB = b;
+	const scomplex *tA = a;
+	const float *tAimag = &a->imag;
+	const scomplex *tB = b;
 	scomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 8; n_iter++)
 	{
@@ -586,12 +615,11 @@ void bli_cgemmsup_rv_zen_asm_2x8n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*8;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*8;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -830,9 +858,9 @@ void bli_cgemmsup_rv_zen_asm_2x8n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		scomplex* restrict cij = c + j_edge*cs_c;
-		scomplex* restrict ai  = a;
-		scomplex* restrict bj  = b + n_iter * 8 ;
+		      scomplex* cij = ( scomplex* )c + j_edge*cs_c;
+		const scomplex* ai  = ( const scomplex* )a;
+		const scomplex* bj  = ( const scomplex* )b + n_iter*ps_b;
 
 		if ( 4 <= n_left )
 		{
@@ -872,20 +900,26 @@ void bli_cgemmsup_rv_zen_asm_2x8n
 
 void bli_cgemmsup_rv_zen_asm_1x8n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const scomplex* restrict alpha = alpha0;
+	const scomplex* restrict a     = a0;
+	const scomplex* restrict b     = b0;
+	const scomplex* restrict beta  = beta0;
+	      scomplex* restrict c     = c0;
+
 
 	//void*    a_next = bli_auxinfo_next_a( data );
 	//void*    b_next = bli_auxinfo_next_b( data );
@@ -900,21 +934,24 @@ void bli_cgemmsup_rv_zen_asm_1x8n
 
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
+
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
 	//scratch registers
 	__m256 ymm0, ymm1, ymm2, ymm3;
 	__m256 ymm4, ymm5, ymm6, ymm7;
-	__m128 xmm0, xmm3;
+	__m128 xmm0 = _mm_setzero_ps();
+	__m128 xmm3 = _mm_setzero_ps();
 
-	scomplex *tA = a;
-	float *tAimag = &a->imag;
-	scomplex *tB = b;
+	const scomplex *tA = a;
+	const float *tAimag = &a->imag;
+	const scomplex *tB = b;
 	scomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 8; n_iter++)
 	{
@@ -928,12 +965,11 @@ void bli_cgemmsup_rv_zen_asm_1x8n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*8;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*8;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -1099,9 +1135,9 @@ void bli_cgemmsup_rv_zen_asm_1x8n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		scomplex* restrict cij = c + j_edge*cs_c;
-		scomplex* restrict ai  = a;
-		scomplex* restrict bj  = b + n_iter * 8;
+		      scomplex* cij = ( scomplex* )c + j_edge*cs_c;
+		const scomplex* ai  = ( const scomplex* )a;
+		const scomplex* bj  = ( const scomplex* )b + n_iter*ps_b;
 
 		if ( 4 <= n_left )
 		{
@@ -1141,20 +1177,26 @@ void bli_cgemmsup_rv_zen_asm_1x8n
 
 void bli_cgemmsup_rv_zen_asm_3x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const scomplex* restrict alpha = alpha0;
+	const scomplex* restrict a     = a0;
+	const scomplex* restrict b     = b0;
+	const scomplex* restrict beta  = beta0;
+	      scomplex* restrict c     = c0;
+
 
 	uint64_t k_iter = 0;
 
@@ -1171,11 +1213,12 @@ void bli_cgemmsup_rv_zen_asm_3x4
 	__m256 ymm4, ymm6;
 	__m256 ymm8, ymm10;
 	__m256 ymm12, ymm14;
-	__m128 xmm0, xmm3;
+	__m128 xmm0 = _mm_setzero_ps();
+	__m128 xmm3 = _mm_setzero_ps();
 
-	scomplex *tA = a;
-	float *tAimag = &a->imag;
-	scomplex *tB = b;
+	const scomplex *tA = a;
+	const float *tAimag = &a->imag;
+	const scomplex *tB = b;
 	scomplex *tC = c;
 	// clear scratch registers.
 	ymm4 = _mm256_setzero_ps();
@@ -1376,20 +1419,26 @@ void bli_cgemmsup_rv_zen_asm_3x4
 
 void bli_cgemmsup_rv_zen_asm_3x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const scomplex* restrict alpha = alpha0;
+	const scomplex* restrict a     = a0;
+	const scomplex* restrict b     = b0;
+	const scomplex* restrict beta  = beta0;
+	      scomplex* restrict c     = c0;
+
 
 	// Typecast local copies of integers in case dim_t and inc_t are a
 	// different size than is expected by load instructions.
@@ -1403,9 +1452,9 @@ void bli_cgemmsup_rv_zen_asm_3x2
 	uint64_t cs_c   = cs_c0;
 
 
-	scomplex *tA = a;
-	float *tAimag = &a->imag;
-	scomplex *tB = b;
+	const scomplex *tA = a;
+	const float *tAimag = &a->imag;
+	const scomplex *tB = b;
 	scomplex *tC = c;
 	// clear scratch registers.
 	__m128 xmm0, xmm1, xmm2, xmm3;
@@ -72,18 +72,18 @@
 
 void bli_zgemmsup_rv_zen_asm_2x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -548,18 +548,18 @@ void bli_zgemmsup_rv_zen_asm_2x4
 
 void bli_zgemmsup_rv_zen_asm_1x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -933,19 +933,18 @@ void bli_zgemmsup_rv_zen_asm_1x4
 
 void bli_zgemmsup_rv_zen_asm_2x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
-
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1320,19 +1319,18 @@ void bli_zgemmsup_rv_zen_asm_2x2
 
 void bli_zgemmsup_rv_zen_asm_1x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
-
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -69,30 +69,49 @@
 */
 void bli_zgemmsup_rv_zen_asm_3x4n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const dcomplex* restrict alpha = alpha0;
+	const dcomplex* restrict a     = a0;
+	const dcomplex* restrict b     = b0;
+	const dcomplex* restrict beta  = beta0;
+	      dcomplex* restrict c     = c0;
+
+	// The kernels below do not implement conjugation of A or B, so defer
+	// to the reference kernel if either operand needs to be conjugated.
+	if ( bli_is_conj( conja ) || bli_is_conj( conjb ) )
+	{
+		bli_zgemmsup_r_zen_ref_3x4
+		(
+		  conja, conjb, m0, n0, k0,
+		  alpha0, a0, rs_a0, cs_a0, b0, rs_b0, cs_b0,
+		  beta0, c0, rs_c0, cs_c0, data, cntx
+		);
+		return;
+	}
+
 	uint64_t m_left = m0 % 3;
 	if ( m_left )
 	{
-		zgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 			NULL,
 			bli_zgemmsup_rv_zen_asm_1x4n,
 			bli_zgemmsup_rv_zen_asm_2x4n,
 		};
-		zgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 		ker_fp
 		(
 			conja, conjb, m_left, n0, k0,
@@ -116,10 +135,11 @@ void bli_zgemmsup_rv_zen_asm_3x4n
 	uint64_t rs_a   = rs_a0;
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
 
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
@@ -131,9 +151,9 @@ void bli_zgemmsup_rv_zen_asm_3x4n
 	__m256d ymm12, ymm13, ymm14, ymm15;
 	__m128d xmm0, xmm3;
 
-	dcomplex *tA = a;
-	double *tAimag = &a->imag;
-	dcomplex *tB = b;
+	const dcomplex *tA = a;
+	const double *tAimag = &a->imag;
+	const dcomplex *tB = b;
 	dcomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 4; n_iter++)
 	{
@@ -156,12 +176,11 @@ void bli_zgemmsup_rv_zen_asm_3x4n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*4;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*4;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -431,9 +450,9 @@ void bli_zgemmsup_rv_zen_asm_3x4n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		dcomplex* restrict cij = c + j_edge*cs_c;
-		dcomplex* restrict ai  = a;
-		dcomplex* restrict bj  = b + n_iter * 4;
+		      dcomplex* cij = ( dcomplex* )c + j_edge*cs_c;
+		const dcomplex* ai  = ( const dcomplex* )a;
+		const dcomplex* bj  = ( const dcomplex* )b + n_iter*ps_b;
 
 		if ( 2 <= n_left )
 		{
@@ -462,20 +481,26 @@ void bli_zgemmsup_rv_zen_asm_3x4n
 
 void bli_zgemmsup_rv_zen_asm_2x4n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const dcomplex* restrict alpha = alpha0;
+	const dcomplex* restrict a     = a0;
+	const dcomplex* restrict b     = b0;
+	const dcomplex* restrict beta  = beta0;
+	      dcomplex* restrict c     = c0;
+
 
 	uint64_t k_iter = 0;
 
@@ -486,10 +511,11 @@ void bli_zgemmsup_rv_zen_asm_2x4n
 	uint64_t rs_a   = rs_a0;
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
 
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
@@ -500,9 +526,9 @@ void bli_zgemmsup_rv_zen_asm_2x4n
 	__m256d ymm8, ymm9, ymm10, ymm11;
 	__m128d xmm0, xmm3;
 
-	dcomplex *tA = a;
-	double *tAimag = &a->imag;
-	dcomplex *tB = b;
+	const dcomplex *tA = a;
+	const double *tAimag = &a->imag;
+	const dcomplex *tB = b;
 	dcomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 4; n_iter++)
 	{
@@ -521,12 +547,11 @@ void bli_zgemmsup_rv_zen_asm_2x4n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*4;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*4;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -731,9 +756,9 @@ void bli_zgemmsup_rv_zen_asm_2x4n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		dcomplex* restrict cij = c + j_edge*cs_c;
-		dcomplex* restrict ai  = a;
-		dcomplex* restrict bj  = b + n_iter * 4;
+		      dcomplex* cij = ( dcomplex* )c + j_edge*cs_c;
+		const dcomplex* ai  = ( const dcomplex* )a;
+		const dcomplex* bj  = ( const dcomplex* )b + n_iter*ps_b;
 
 		if ( 2 <= n_left )
 		{
@@ -762,20 +787,26 @@ void bli_zgemmsup_rv_zen_asm_2x4n
 
 void bli_zgemmsup_rv_zen_asm_1x4n
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const dcomplex* restrict alpha = alpha0;
+	const dcomplex* restrict a     = a0;
+	const dcomplex* restrict b     = b0;
+	const dcomplex* restrict beta  = beta0;
+	      dcomplex* restrict c     = c0;
+
 	//void*    a_next = bli_auxinfo_next_a( data );
 	//void*    b_next = bli_auxinfo_next_b( data );
 
@@ -789,10 +820,11 @@ void bli_zgemmsup_rv_zen_asm_1x4n
 
 	uint64_t cs_a   = cs_a0;
 	uint64_t rs_b   = rs_b0;
-	uint64_t cs_b   = cs_b0;
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of B.
+	uint64_t ps_b   = bli_auxinfo_ps_b( data );
 
 	if ( n_iter == 0 ) goto consider_edge_cases;
 
@@ -802,9 +834,9 @@ void bli_zgemmsup_rv_zen_asm_1x4n
 	__m256d ymm4, ymm5, ymm6, ymm7;
 	__m128d xmm0, xmm3;
 
-	dcomplex *tA = a;
-	double *tAimag = &a->imag;
-	dcomplex *tB = b;
+	const dcomplex *tA = a;
+	const double *tAimag = &a->imag;
+	const dcomplex *tB = b;
 	dcomplex *tC = c;
 	for (n_iter = 0; n_iter < n0 / 4; n_iter++)
 	{
@@ -818,12 +850,11 @@ void bli_zgemmsup_rv_zen_asm_1x4n
 		dim_t tc_inc_row = rs_c;
 
 		dim_t ta_inc_col = cs_a;
-		dim_t tb_inc_col = cs_b;
 		dim_t tc_inc_col = cs_c;
 
 		tA = a;
 		tAimag = &a->imag;
-		tB = b + n_iter*tb_inc_col*4;
+		tB = b + n_iter*ps_b;
 		tC = c + n_iter*tc_inc_col*4;
 		for (k_iter = 0; k_iter <k0; k_iter++)
 		{
@@ -960,9 +991,9 @@ void bli_zgemmsup_rv_zen_asm_1x4n
 		const dim_t      mr_cur = 3;
 		const dim_t      j_edge = n0 - ( dim_t )n_left;
 
-		dcomplex* restrict cij = c + j_edge*cs_c;
-		dcomplex* restrict ai  = a;
-		dcomplex* restrict bj  = b + n_iter * 4;
+		      dcomplex* cij = ( dcomplex* )c + j_edge*cs_c;
+		const dcomplex* ai  = ( const dcomplex* )a;
+		const dcomplex* bj  = ( const dcomplex* )b + n_iter*ps_b;
 
 		if ( 2 <= n_left )
 		{
@@ -989,20 +1020,26 @@ void bli_zgemmsup_rv_zen_asm_1x4n
 
 void bli_zgemmsup_rv_zen_asm_3x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha0,
+       const void*      a0, inc_t rs_a0, inc_t cs_a0,
+       const void*      b0, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
+	const dcomplex* restrict alpha = alpha0;
+	const dcomplex* restrict a     = a0;
+	const dcomplex* restrict b     = b0;
+	const dcomplex* restrict beta  = beta0;
+	      dcomplex* restrict c     = c0;
+
 	uint64_t k_iter = 0;
 
 	uint64_t rs_a   = rs_a0;
@@ -1021,9 +1058,9 @@ void bli_zgemmsup_rv_zen_asm_3x2
 	__m256d ymm12, ymm14;
 	__m128d xmm0, xmm3;
 
-	dcomplex *tA = a;
-	double *tAimag = &a->imag;
-	dcomplex *tB = b;
+	const dcomplex *tA = a;
+	const double *tAimag = &a->imag;
+	const dcomplex *tB = b;
 	dcomplex *tC = c;
 	// clear scratch registers.
 	ymm4 = _mm256_setzero_pd();
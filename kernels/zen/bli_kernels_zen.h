@@ -211,3 +211,7 @@ GEMMSUP_KER_PROT( dcomplex,   z, gemmsup_rv_zen_asm_1x4n )
 GEMMSUP_KER_PROT( dcomplex,   z, gemmsup_rv_zen_asm_3x2 )
 GEMMSUP_KER_PROT( dcomplex,   z, gemmsup_rv_zen_asm_3x1 )
 
+// gemmsup_r (reference fallback for conjugated operands)
+GEMMSUP_KER_PROT( scomplex,   c, gemmsup_r_zen_ref_3x8 )
+GEMMSUP_KER_PROT( dcomplex,   z, gemmsup_r_zen_ref_3x4 )
+
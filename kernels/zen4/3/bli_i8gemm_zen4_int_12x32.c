@@ -0,0 +1,124 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   An int8 gemm microkernel for AVX-512 VNNI that computes a 12x32 tile of
+   int32 dot products. Both micropanels store groups of four consecutive k
+   values per row (of A) or column (of B), with A holding unsigned and B
+   holding signed bytes, which is exactly the operand layout of vpdpbusd:
+   each 32-bit lane accumulates the four products of one group. The 24
+   accumulators, two vectors of B and one broadcast of A fit in the 32 zmm
+   registers.
+*/
+
+#define I8GEMM_ZEN4_ROW( r ) \
+	{ \
+		__m512i a_r = _mm512_set1_epi32( *( const int32_t* )( a + 4*r ) ); \
+		c ## r ## _0 = _mm512_dpbusd_epi32( c ## r ## _0, a_r, b0 ); \
+		c ## r ## _1 = _mm512_dpbusd_epi32( c ## r ## _1, a_r, b1 ); \
+	}
+
+#define I8GEMM_ZEN4_STORE( r ) \
+	{ \
+		_mm512_storeu_si512( ab + r*rs_ab +  0, c ## r ## _0 ); \
+		_mm512_storeu_si512( ab + r*rs_ab + 16, c ## r ## _1 ); \
+	}
+
+void bli_i8gemm_zen4_int_12x32
+     (
+             dim_t      k,
+       const void*      a0,
+       const void*      b0_,
+             void*      ab0,
+             inc_t      rs_ab,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const uint8_t* restrict a  = a0;
+	const int8_t*  restrict b  = b0_;
+	      int32_t* restrict ab = ab0;
+
+	__m512i c0_0  = _mm512_setzero_si512(), c0_1  = _mm512_setzero_si512();
+	__m512i c1_0  = _mm512_setzero_si512(), c1_1  = _mm512_setzero_si512();
+	__m512i c2_0  = _mm512_setzero_si512(), c2_1  = _mm512_setzero_si512();
+	__m512i c3_0  = _mm512_setzero_si512(), c3_1  = _mm512_setzero_si512();
+	__m512i c4_0  = _mm512_setzero_si512(), c4_1  = _mm512_setzero_si512();
+	__m512i c5_0  = _mm512_setzero_si512(), c5_1  = _mm512_setzero_si512();
+	__m512i c6_0  = _mm512_setzero_si512(), c6_1  = _mm512_setzero_si512();
+	__m512i c7_0  = _mm512_setzero_si512(), c7_1  = _mm512_setzero_si512();
+	__m512i c8_0  = _mm512_setzero_si512(), c8_1  = _mm512_setzero_si512();
+	__m512i c9_0  = _mm512_setzero_si512(), c9_1  = _mm512_setzero_si512();
+	__m512i c10_0 = _mm512_setzero_si512(), c10_1 = _mm512_setzero_si512();
+	__m512i c11_0 = _mm512_setzero_si512(), c11_1 = _mm512_setzero_si512();
+
+	for ( dim_t l = 0; l < k; l += 4 )
+	{
+		__m512i b0 = _mm512_loadu_si512( b +  0 );
+		__m512i b1 = _mm512_loadu_si512( b + 64 );
+
+		I8GEMM_ZEN4_ROW( 0 )
+		I8GEMM_ZEN4_ROW( 1 )
+		I8GEMM_ZEN4_ROW( 2 )
+		I8GEMM_ZEN4_ROW( 3 )
+		I8GEMM_ZEN4_ROW( 4 )
+		I8GEMM_ZEN4_ROW( 5 )
+		I8GEMM_ZEN4_ROW( 6 )
+		I8GEMM_ZEN4_ROW( 7 )
+		I8GEMM_ZEN4_ROW( 8 )
+		I8GEMM_ZEN4_ROW( 9 )
+		I8GEMM_ZEN4_ROW( 10 )
+		I8GEMM_ZEN4_ROW( 11 )
+
+		a += 4 * 12;
+		b += 4 * 32;
+	}
+
+	I8GEMM_ZEN4_STORE( 0 )
+	I8GEMM_ZEN4_STORE( 1 )
+	I8GEMM_ZEN4_STORE( 2 )
+	I8GEMM_ZEN4_STORE( 3 )
+	I8GEMM_ZEN4_STORE( 4 )
+	I8GEMM_ZEN4_STORE( 5 )
+	I8GEMM_ZEN4_STORE( 6 )
+	I8GEMM_ZEN4_STORE( 7 )
+	I8GEMM_ZEN4_STORE( 8 )
+	I8GEMM_ZEN4_STORE( 9 )
+	I8GEMM_ZEN4_STORE( 10 )
+	I8GEMM_ZEN4_STORE( 11 )
+}
+
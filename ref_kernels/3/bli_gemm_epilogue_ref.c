@@ -0,0 +1,177 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Reference gemm epilogue kernel. Applies the per-row or per-column scale
+// and bias vectors and the activation function of a gemm_epilogue_t to the
+// m x n tile of C whose top-left element lies at (off_m,off_n) within the
+// full matrix. The tile is expected to be resident in cache, having just
+// been written by the gemm micro-kernel.
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname, arch, suf ) \
+\
+static void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+       const gemm_epilogue_t* epilogue, \
+             dim_t            n, \
+             ctype*  restrict x, inc_t incx \
+     ) \
+{ \
+	const ctype lo = ( ctype )epilogue->act_lo; \
+	const ctype hi = ( ctype )epilogue->act_hi; \
+\
+	switch ( epilogue->act ) \
+	{ \
+		case BLIS_ACT_RELU: \
+			for ( dim_t i = 0; i < n; ++i ) \
+				x[ i*incx ] = bli_max( x[ i*incx ], ( ctype )0 ); \
+			break; \
+		case BLIS_ACT_GELU: \
+			for ( dim_t i = 0; i < n; ++i ) \
+			{ \
+				const ctype xi = x[ i*incx ]; \
+				x[ i*incx ] = ( ctype )( 0.5 * xi * ( 1.0 + erf( xi * 0.70710678118654752440 ) ) ); \
+			} \
+			break; \
+		case BLIS_ACT_CLAMP: \
+			for ( dim_t i = 0; i < n; ++i ) \
+				x[ i*incx ] = bli_min( bli_max( x[ i*incx ], lo ), hi ); \
+			break; \
+		default: \
+			break; \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC( gemm_epilogue_act, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ch, opname, arch, suf ) \
+\
+static void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+       const gemm_epilogue_t* epilogue, \
+             dim_t            n, \
+             ctype*  restrict x, inc_t incx \
+     ) \
+{ \
+	/* Activation functions are rejected for complex datatypes by
+	   bli_gemm_epilogue_check(). */ \
+	( void )epilogue; ( void )n; ( void )x; ( void )incx; \
+}
+
+INSERT_GENTFUNCCO_BASIC( gemm_epilogue_act, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      off_m, \
+             dim_t      off_n, \
+       const void*      epilogue0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	( void )data; \
+	( void )cntx; \
+\
+	const gemm_epilogue_t* epilogue = epilogue0; \
+	      ctype*           c        = c0; \
+\
+	/* Walk the tile so that the inner loop steps through the dimension of
+	   C with the smaller stride. A vector is then indexed by either the
+	   inner (i) or the outer (j) loop, depending on its side. */ \
+	side_t side_i = BLIS_LEFT; \
+	if ( bli_abs( cs_c ) < bli_abs( rs_c ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_dims( &off_m, &off_n ); \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		side_i = BLIS_RIGHT; \
+	} \
+\
+	const ctype* s     = NULL; \
+	      inc_t  incis = 0; \
+	      inc_t  incjs = 0; \
+	const ctype* b     = NULL; \
+	      inc_t  incib = 0; \
+	      inc_t  incjb = 0; \
+\
+	if ( epilogue->scale ) \
+	{ \
+		const inc_t incs = bli_obj_vector_inc( epilogue->scale ); \
+		s = bli_obj_buffer_at_off( epilogue->scale ); \
+		if ( epilogue->scale_side == side_i ) { s += off_m * incs; incis = incs; } \
+		else                                  { s += off_n * incs; incjs = incs; } \
+	} \
+\
+	if ( epilogue->bias ) \
+	{ \
+		const inc_t incb = bli_obj_vector_inc( epilogue->bias ); \
+		b = bli_obj_buffer_at_off( epilogue->bias ); \
+		if ( epilogue->bias_side == side_i ) { b += off_m * incb; incib = incb; } \
+		else                                 { b += off_n * incb; incjb = incb; } \
+	} \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		ctype* restrict cj = c + j*cs_c; \
+\
+		if ( s ) \
+		{ \
+			const ctype* restrict sj = s + j*incjs; \
+			for ( dim_t i = 0; i < m; ++i ) \
+				bli_tscals( ch,ch,ch, sj[ i*incis ], cj[ i*rs_c ] ); \
+		} \
+\
+		if ( b ) \
+		{ \
+			const ctype* restrict bj = b + j*incjb; \
+			for ( dim_t i = 0; i < m; ++i ) \
+				bli_tadds( ch,ch,ch, bj[ i*incib ], cj[ i*rs_c ] ); \
+		} \
+\
+		if ( epilogue->act != BLIS_ACT_NONE ) \
+			PASTEMAC(ch,gemm_epilogue_act,arch,suf)( epilogue, m, cj, rs_c ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_epilogue, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,86 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Reference int8 gemm micro-kernel. Computes the MR x NR int32 product of
+// a packed micropanel of A, whose elements are unsigned bytes, and a packed
+// micropanel of B, whose elements are signed bytes. Both micropanels store
+// groups of four consecutive k values contiguously for each row (of A) or
+// column (of B), so k must be a multiple of four.
+
+void PASTEMAC(i8gemm,BLIS_CNAME_INFIX,BLIS_REF_SUFFIX)
+     (
+             dim_t      k,
+       const void*      a0,
+       const void*      b0,
+             void*      ab0, inc_t rs_ab,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const dim_t             mr = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_MR_I8, cntx );
+	const dim_t             nr = bli_cntx_get_blksz_def_dt( BLIS_I8GEMM_DT, BLIS_NR_I8, cntx );
+
+	const uint8_t* restrict a  = a0;
+	const int8_t*  restrict b  = b0;
+	      int32_t* restrict ab = ab0;
+
+	for ( dim_t i = 0; i < mr; ++i )
+	for ( dim_t j = 0; j < nr; ++j )
+		ab[ i*rs_ab + j ] = 0;
+
+	for ( dim_t l = 0; l < k; l += 4 )
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			const uint8_t* restrict ai  = a + i*4;
+			      int32_t* restrict abi = ab + i*rs_ab;
+
+			for ( dim_t j = 0; j < nr; ++j )
+			{
+				const int8_t* restrict bj = b + j*4;
+
+				abi[ j ] += ( int32_t )ai[ 0 ] * bj[ 0 ] +
+				            ( int32_t )ai[ 1 ] * bj[ 1 ] +
+				            ( int32_t )ai[ 2 ] * bj[ 2 ] +
+				            ( int32_t )ai[ 3 ] * bj[ 3 ];
+			}
+		}
+
+		a += 4*mr;
+		b += 4*nr;
+	}
+}
+
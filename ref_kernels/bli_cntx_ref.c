@@ -135,6 +135,14 @@ INSERT_PROTMAC_BASIC( GEMMTRSM_UKR_PROT, gemmtrsm_u_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_l_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_u_ukr_name )
 
+#define i8gemm_ukr_name     GENBARNAME(i8gemm)
+
+I8GEMM_UKR_PROT( i8gemm_ukr_name )
+
+#define gemm_epilogue_ukr_name GENARNAME(gemm_epilogue)
+
+INSERT_PROTMAC_BASIC( GEMM_EPILOGUE_UKR_PROT, gemm_epilogue_ukr_name )
+
 
 // -- Level-3 virtual micro-kernel prototype redefinitions ---------------------
 
@@ -405,6 +413,32 @@ void GENBARNAME(cntx_init)
 	bli_blksz_init_easy( &blkszs[ BLIS_NT ],    0,    0,    0,    0 );
 	bli_blksz_init_easy( &blkszs[ BLIS_KT ],    0,    0,    0,    0 );
 
+	// -- Set int8 gemm blocksizes ---------------------------------------------
+
+	// NOTE: The int8 gemm blocksizes are not parameterized by datatype, so
+	// every slot holds the same value (see BLIS_I8GEMM_DT). KC must be a
+	// multiple of four since packed int8 panels interleave groups of four
+	// consecutive k values.
+	//                                               s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_I8 ],      4,     4,     4,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_I8 ],     16,    16,    16,    16 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_I8 ],    128,   128,   128,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_I8 ],    512,   512,   512,   512 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_I8 ],   4096,  4096,  4096,  4096 );
+
+	// -- Set alternate gemm blocksizes ----------------------------------------
+
+	// NOTE: These are only used when a configuration registers a gemm
+	// micro-kernel with the opposite storage preference (BLIS_GEMM_ALT_UKR),
+	// which is not the case for the reference configuration. The defaults
+	// simply swap the register blocksizes of the native micro-kernel.
+	//                                                        s              d              c              z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_ALT ],     BLIS_NR_s,     BLIS_NR_d,     BLIS_NR_c,     BLIS_NR_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_ALT ],     BLIS_MR_s,     BLIS_MR_d,     BLIS_MR_c,     BLIS_MR_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_ALT ],           256,           128,           128,            64 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_ALT ],           256,           256,           256,           256 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_ALT ],          4096,          4096,          4096,          4096 );
+
 	// Initialize the context with the default blocksize objects and their
 	// multiples.
 	bli_cntx_set_blkszs
@@ -426,6 +460,16 @@ void GENBARNAME(cntx_init)
 	  BLIS_KT,  &blkszs[ BLIS_KT  ], BLIS_KT,
 	  BLIS_BBM, &blkszs[ BLIS_BBM ], BLIS_BBM,
 	  BLIS_BBN, &blkszs[ BLIS_BBN ], BLIS_BBN,
+	  BLIS_NC_I8, &blkszs[ BLIS_NC_I8 ], BLIS_NR_I8,
+	  BLIS_KC_I8, &blkszs[ BLIS_KC_I8 ], BLIS_KC_I8,
+	  BLIS_MC_I8, &blkszs[ BLIS_MC_I8 ], BLIS_MR_I8,
+	  BLIS_NR_I8, &blkszs[ BLIS_NR_I8 ], BLIS_NR_I8,
+	  BLIS_MR_I8, &blkszs[ BLIS_MR_I8 ], BLIS_MR_I8,
+	  BLIS_NC_ALT, &blkszs[ BLIS_NC_ALT ], BLIS_NR_ALT,
+	  BLIS_KC_ALT, &blkszs[ BLIS_KC_ALT ], BLIS_KR,
+	  BLIS_MC_ALT, &blkszs[ BLIS_MC_ALT ], BLIS_MR_ALT,
+	  BLIS_NR_ALT, &blkszs[ BLIS_NR_ALT ], BLIS_NR_ALT,
+	  BLIS_MR_ALT, &blkszs[ BLIS_MR_ALT ], BLIS_MR_ALT,
 	  BLIS_VA_END
 	);
 
@@ -447,6 +491,17 @@ void GENBARNAME(cntx_init)
 	gen_func_init_ro( &funcs[ bli_ker_idx( BLIS_GEMMTRSM1M_L_UKR ) ], gemmtrsm1m_l_ukr_name );
 	gen_func_init_ro( &funcs[ bli_ker_idx( BLIS_GEMMTRSM1M_U_UKR ) ], gemmtrsm1m_u_ukr_name );
 
+	// The int8 gemm micro-kernel is not parameterized by datatype, so every
+	// slot holds the same function (see BLIS_I8GEMM_DT).
+	bli_func_init( &funcs[ bli_ker_idx( BLIS_I8GEMM_UKR ) ], i8gemm_ukr_name, i8gemm_ukr_name,
+	                                                         i8gemm_ukr_name, i8gemm_ukr_name );
+
+	gen_func_init( &funcs[ bli_ker_idx( BLIS_GEMM_EPILOGUE_UKR ) ], gemm_epilogue_ukr_name );
+
+	// There is no reference gemm micro-kernel with the opposite storage
+	// preference, so BLIS_GEMM_ALT_UKR is left NULL and the framework
+	// transposes the operation instead (see bli_gemm_cntl_init()).
+
 	//                                                           s      d      c      z
 	bli_mbool_init( &mbools[ BLIS_GEMM_UKR_ROW_PREF ],        TRUE,  TRUE,  TRUE,  TRUE );
 	bli_mbool_init( &mbools[ BLIS_GEMMTRSM_L_UKR_ROW_PREF ], FALSE, FALSE, FALSE, FALSE );
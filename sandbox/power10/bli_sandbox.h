@@ -93,7 +93,6 @@ GEMM_UKR_PROT2(  nibbles, int32_t,  i4, gemm_power10_mma_8x16 )
 GEMM_FUNC_PROT(  float16,   float,  sh);
 GEMM_FUNC_PROT( bfloat16,   float,  sb);
 GEMM_FUNC_PROT(  int16_t, int32_t, i16);
-GEMM_FUNC_PROT(   int8_t, int32_t,  i8);
 GEMM_FUNC_PROT(  nibbles, int32_t,  i4);
 
 // pack kernel prototypes
@@ -90,24 +90,6 @@ GENERIC_GEMM(
     0 // B_ALIGN
 );
 
-GENERIC_GEMM( 
-    i8, // kernel name prefix 
-    int8_t, // input type
-    int, // output type    
-    (pb/4 + (pb%4>0)), // innermost loop iterations
-    i8_pack_a, // pack kernel for A
-    i8_pack_b, // pack kernel for B
-    bli_i8gemm_power10_mma_8x16, // microkernel function name
-    4, // K_MMA
-    8, // MR
-    16, // NR
-    384, // MC
-    6656, // KC
-    4096, // NC
-    0, // A_ALIGN
-    0 // B_ALIGN
-);
-
 GENERIC_GEMM( 
     i4, // kernel name prefix 
     nibbles, // input type
@@ -0,0 +1,73 @@
+#!/bin/bash
+
+# Compare the performance of BLIS gemm with the memory pools of the packing
+# block allocator backed by regular pages (BLIS_HUGE_PAGES=0) and by huge
+# pages (BLIS_HUGE_PAGES=1). Build the drivers first with 'make blis'
+# (and 'make blis-mt' for the multithreaded runs).
+
+# File pefixes.
+exec_root="test"
+out_root="output_hugepages"
+
+# Problem size range for single- and multithreaded execution.
+psr_st="500 4000 500"
+psr_mt="1000 8000 1000"
+
+# Threading suffixes to test, and the number of threads to use (via
+# BLIS_NUM_THREADS) for the multithreaded drivers.
+tsufs="st mt"
+nt_mt=4
+
+# Datatypes and operations to test.
+test_dts="s d"
+test_ops="gemm_nn"
+
+# Number of repeats per problem size.
+nrepeats=3
+
+for tsuf in ${tsufs}; do
+
+	exec_name="${exec_root}_gemm_blis_${tsuf}.x"
+
+	if [ ! -x "./${exec_name}" ]; then
+		echo "Could not find ${exec_name}. Skipping."
+		continue
+	fi
+
+	if [ "${tsuf}" = "mt" ]; then
+		export BLIS_NUM_THREADS=${nt_mt}
+		psr="${psr_mt}"
+	else
+		export BLIS_NUM_THREADS=1
+		psr="${psr_st}"
+	fi
+
+	for dt in ${test_dts}; do
+
+		for op in ${test_ops}; do
+
+			oppars=${op##*_};
+			opname=${op%%_*}
+
+			for hp in 0 1; do
+
+				out_file="${out_root}${hp}_${tsuf}_${dt}${opname}_${oppars}_blis.m"
+
+				printf 'Running BLIS_HUGE_PAGES=%s ./%s -d %s -c %s -p "%s" -r %s > %s\n' \
+				       "${hp}" "${exec_name}" "${dt}" "${oppars}" "${psr}" \
+				       "${nrepeats}" "${out_file}"
+
+				BLIS_HUGE_PAGES=${hp} ./${exec_name} -d ${dt} -c ${oppars} \
+				                      -p "${psr}" -r ${nrepeats} -q > ${out_file}
+			done
+
+			# Print the results side by side: problem size, followed by the
+			# gflops with regular pages and with huge pages.
+			echo "% ${tsuf} ${dt}${opname}_${oppars}:  m n k  gflops(off)  gflops(on)"
+			paste "${out_root}0_${tsuf}_${dt}${opname}_${oppars}_blis.m" \
+			      "${out_root}1_${tsuf}_${dt}${opname}_${oppars}_blis.m" \
+			| grep '^data' | tr -d '[];' \
+			| awk '$6 != 0 { printf "%6s %6s %6s  %8s  %8s\n", $6, $7, $8, $9, $18 }'
+		done
+	done
+done
@@ -0,0 +1,121 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the average latency of the barrier used by the
+// communicators of the current threading implementation as the number of
+// participating threads grows. Communicators with at least
+// BLIS_BARRIER_TREE_THRESH threads use a combining tree barrier; to compare
+// against the centralized barrier, run the driver a second time with that
+// environment variable set to 0.
+
+typedef struct
+{
+	dim_t  n_barriers;
+	double dtime;
+} params_t;
+
+static void time_barriers( thrcomm_t* comm, dim_t tid, const void* params_void )
+{
+	params_t* params     = ( params_t* )params_void;
+	dim_t     n_barriers = params->n_barriers;
+
+	// Synchronize once before starting the clock so that the time spent
+	// waking up the threads is not counted.
+	bli_thrcomm_barrier( tid, comm );
+
+	double dtime = bli_clock();
+
+	for ( dim_t i = 0; i < n_barriers; ++i )
+		bli_thrcomm_barrier( tid, comm );
+
+	dtime = bli_clock_min_diff( DBL_MAX, dtime );
+
+	if ( tid == 0 ) params->dtime = dtime;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t   p_begin, p_max, p_inc;
+	dim_t   n_repeats;
+	timpl_t ti;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	ti = bli_thread_get_thread_impl();
+
+	if ( ti == BLIS_SINGLE )
+	{
+		printf( "BLIS was not configured with multithreading.\n" );
+		return 1;
+	}
+
+	printf( "%% threading implementation: %s\n", bli_thread_get_thread_impl_str( ti ) );
+	printf( "%% tree barrier threshold:   %d\n",
+	        ( int )bli_env_get_var( "BLIS_BARRIER_TREE_THRESH", BLIS_BARRIER_TREE_THRESH ) );
+	printf( "%% nt  usec/barrier\n" );
+
+	for ( dim_t nt = p_begin; nt <= p_max; nt += p_inc )
+	{
+		double dtime_save = DBL_MAX;
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			params_t params;
+			params.n_barriers = N_BARRIERS;
+			params.dtime      = 0.0;
+
+			bli_thread_launch( ti, nt, time_barriers, &params );
+
+			dtime_save = bli_min( dtime_save, params.dtime );
+		}
+
+		printf( "%4lu  %10.4f\n", ( unsigned long )nt,
+		        1.0e6 * dtime_save / ( double )N_BARRIERS );
+		fflush( stdout );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -0,0 +1,181 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares bli_gemm_ex() with a fused epilogue (a per-row scale,
+// a per-column bias, and a ReLU activation) against an unfused bli_gemm_ex()
+// followed by a separate pass over C. Both column- and row-stored C are
+// tested so that the epilogue is exercised whether or not the operation is
+// transposed internally, and the problem sizes span both the sup and the
+// conventional code paths as well as multiple iterations of the k loop.
+
+static void epilogue_ref( const obj_t* s, const obj_t* b, obj_t* c )
+{
+	dim_t   m    = bli_obj_length( c );
+	dim_t   n    = bli_obj_width( c );
+	double* cp   = bli_obj_buffer( c );
+	inc_t   rs_c = bli_obj_row_stride( c );
+	inc_t   cs_c = bli_obj_col_stride( c );
+	double* sp   = bli_obj_buffer( s );
+	double* bp   = bli_obj_buffer( b );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double* cij = cp + i*rs_c + j*cs_c;
+		*cij = bli_max( sp[ i ] * *cij + bp[ j ], 0.0 );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  m, n, k;
+	dim_t  p_begin, p_max, p_inc;
+	dim_t  n_repeats;
+	num_t  dt = BLIS_DOUBLE;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	printf( "%% stor     m     n     k  gflops(fused)  gflops(unfused)  max_diff\n" );
+
+	for ( int row_stor = 0; row_stor < 2; ++row_stor )
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		double dtime_fused   = DBL_MAX;
+		double dtime_unfused = DBL_MAX;
+
+		m = p;
+		n = p;
+		k = p;
+
+		obj_t a, b, c, c_save, c_ref, scale, bias;
+		obj_t alpha, beta, norm;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		if ( row_stor )
+		{
+			bli_obj_create( dt, m, n, n, 1, &c );
+			bli_obj_create( dt, m, n, n, 1, &c_save );
+			bli_obj_create( dt, m, n, n, 1, &c_ref );
+		}
+		else
+		{
+			bli_obj_create( dt, m, n, 0, 0, &c );
+			bli_obj_create( dt, m, n, 0, 0, &c_save );
+			bli_obj_create( dt, m, n, 0, 0, &c_ref );
+		}
+		bli_obj_create( dt, m, 1, 0, 0, &scale );
+		bli_obj_create( dt, n, 1, 0, 0, &bias );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_obj_scalar_init_detached( dt, &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_save );
+		bli_randv( &scale );
+		bli_randv( &bias );
+
+		bli_setsc(  1.2, 0.0, &alpha );
+		bli_setsc( -0.9, 0.0, &beta );
+
+		gemm_epilogue_t epilogue;
+		bli_gemm_epilogue_init( &epilogue );
+		epilogue.scale      = &scale;
+		epilogue.scale_side = BLIS_LEFT;
+		epilogue.bias       = &bias;
+		epilogue.bias_side  = BLIS_RIGHT;
+		epilogue.act        = BLIS_ACT_RELU;
+
+		rntm_t rntm = BLIS_RNTM_INITIALIZER;
+		bli_rntm_init_from_global( &rntm );
+		bli_rntm_set_epilogue( &epilogue, &rntm );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c );
+
+			double dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm );
+
+			dtime_fused = bli_clock_min_diff( dtime_fused, dtime );
+
+			bli_copym( &c_save, &c_ref );
+
+			dtime = bli_clock();
+
+			bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+			epilogue_ref( &scale, &bias, &c_ref );
+
+			dtime_unfused = bli_clock_min_diff( dtime_unfused, dtime );
+		}
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+
+		double diff, diff_i;
+		bli_getsc( &norm, &diff, &diff_i );
+
+		double gflops_fused   = ( 2.0 * m * n * k ) / ( dtime_fused * 1.0e9 );
+		double gflops_unfused = ( 2.0 * m * n * k ) / ( dtime_unfused * 1.0e9 );
+
+		printf( "%6s %5lu %5lu %5lu  %13.2f  %15.2f  %8.2e\n",
+		        row_stor ? "row" : "col",
+		        ( unsigned long )m, ( unsigned long )n, ( unsigned long )k,
+		        gflops_fused, gflops_unfused, diff );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+		bli_obj_free( &scale );
+		bli_obj_free( &bias );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the performance of bli_i8gemm_ex() on square problems
+// and checks its results against a naive reference. A is stored by columns
+// and transposed, B is stored by rows, and both carry per-row and per-column
+// zero points, so that the transposition, zero point correction, and general
+// stride paths are all exercised. The int32 results must match exactly. The
+// same product is then requantized to float via bli_i8sgemm_ex() with
+// per-row and per-column scales and compared in relative terms.
+
+static void fill_i8( dim_t len, int8_t* x )
+{
+	for ( dim_t i = 0; i < len; ++i )
+		x[ i ] = ( int8_t )( ( rand() % 256 ) - 128 );
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  m, n, k;
+	dim_t  p_begin, p_max, p_inc;
+	dim_t  n_repeats;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	printf( "%%     m     n     k  gops(i8gemm)  max_err(i32)  max_rel_err(f32)\n" );
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		double dtime_save = DBL_MAX;
+
+		m = p;
+		n = p;
+		k = p;
+
+		// A is k x m stored by columns and used transposed; B is k x n
+		// stored by rows; C is m x n stored by columns with a padded
+		// leading dimension.
+		const inc_t lda = k;
+		const inc_t ldb = n;
+		const inc_t ldc = m + 3;
+
+		int8_t*  a      = malloc( k * m * sizeof( int8_t ) );
+		int8_t*  b      = malloc( k * n * sizeof( int8_t ) );
+		int32_t* c      = malloc( ldc * n * sizeof( int32_t ) );
+		int32_t* c_save = malloc( ldc * n * sizeof( int32_t ) );
+		float*   cs     = malloc( ldc * n * sizeof( float ) );
+		int32_t* za     = malloc( m * sizeof( int32_t ) );
+		int32_t* zb     = malloc( n * sizeof( int32_t ) );
+		float*   sa     = malloc( m * sizeof( float ) );
+		float*   sb     = malloc( n * sizeof( float ) );
+
+		fill_i8( k * m, a );
+		fill_i8( k * n, b );
+
+		for ( dim_t i = 0; i < ldc * n; ++i ) c_save[ i ] = ( rand() % 2001 ) - 1000;
+		for ( dim_t i = 0; i < m; ++i ) { za[ i ] = ( rand() % 21 ) - 10; sa[ i ] = 1.0f / ( 1 + i % 7 ); }
+		for ( dim_t j = 0; j < n; ++j ) { zb[ j ] = ( rand() % 21 ) - 10; sb[ j ] = 1.0f / ( 1 + j % 5 ); }
+
+		i8gemm_qparams_t qparams;
+		bli_i8gemm_qparams_init( &qparams );
+		qparams.za = za; qparams.incza = 1;
+		qparams.zb = zb; qparams.inczb = 1;
+		qparams.sa = sa; qparams.incsa = 1;
+		qparams.sb = sb; qparams.incsb = 1;
+
+		const int32_t alpha = 2;
+		const int32_t beta  = -1;
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			memcpy( c, c_save, ldc * n * sizeof( int32_t ) );
+
+			double dtime = bli_clock();
+
+			bli_i8gemm_ex( BLIS_TRANSPOSE, BLIS_NO_TRANSPOSE,
+			               m, n, k,
+			               &alpha,
+			               a, 1, lda,
+			               b, ldb, 1,
+			               &beta,
+			               c, 1, ldc,
+			               &qparams, NULL, NULL );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		const float alpha_s = 0.5f;
+		const float beta_s  = 0.0f;
+
+		bli_i8sgemm_ex( BLIS_TRANSPOSE, BLIS_NO_TRANSPOSE,
+		                m, n, k,
+		                &alpha_s,
+		                a, 1, lda,
+		                b, ldb, 1,
+		                &beta_s,
+		                cs, 1, ldc,
+		                &qparams, NULL, NULL );
+
+		int64_t max_err     = 0;
+		double  max_rel_err = 0.0;
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			int64_t ab = 0;
+
+			for ( dim_t l = 0; l < k; ++l )
+				ab += ( int64_t )( a[ l + i*lda ] - za[ i ] ) *
+				      ( int64_t )( b[ l*ldb + j ] - zb[ j ] );
+
+			int64_t ref = alpha * ab + beta * ( int64_t )c_save[ i + j*ldc ];
+			int64_t err = ref - c[ i + j*ldc ];
+			if ( err < 0 ) err = -err;
+			if ( max_err < err ) max_err = err;
+
+			double ref_s = alpha_s * sa[ i ] * sb[ j ] * ( double )ab;
+			double err_s = fabs( ref_s - cs[ i + j*ldc ] ) / bli_max( fabs( ref_s ), 1.0 );
+			if ( max_rel_err < err_s ) max_rel_err = err_s;
+		}
+
+		double gops = ( 2.0 * m * n * k ) / ( dtime_save * 1.0e9 );
+
+		printf( "%6lu %5lu %5lu  %12.2f  %12ld  %16.2e\n",
+		        ( unsigned long )m, ( unsigned long )n, ( unsigned long )k,
+		        gops, ( long )max_err, max_rel_err );
+
+		free( a );
+		free( b );
+		free( c );
+		free( c_save );
+		free( cs );
+		free( za );
+		free( zb );
+		free( sa );
+		free( sb );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -0,0 +1,156 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares bli_gemm_ex() with the k dimension (the pc loop)
+// partitioned among groups of threads against a single-threaded bli_gemm_ex()
+// for problems with small m and n but a large k, which cannot be parallelized
+// effectively along m or n. The number of ways of parallelism in the pc loop
+// may be given as the first argument (the default is 4). Both column- and
+// row-stored C are tested so that the reduction is exercised whether or not
+// the operation is transposed internally.
+
+int main( int argc, char** argv )
+{
+	dim_t  m, n, k;
+	dim_t  p_begin, p_max, p_inc;
+	dim_t  n_repeats;
+	dim_t  pc_nt;
+	num_t  dt = BLIS_DOUBLE;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	pc_nt = argc > 1 ? atoi( argv[ 1 ] ) : 4;
+
+	printf( "%% pc_nt: %d\n", ( int )pc_nt );
+	printf( "%% stor     m     n       k  gflops(pc)  gflops(serial)  max_diff\n" );
+
+	for ( int row_stor = 0; row_stor < 2; ++row_stor )
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		double dtime_pc     = DBL_MAX;
+		double dtime_serial = DBL_MAX;
+
+		m = p;
+		n = p;
+		k = K_SIZE;
+
+		obj_t a, b, c, c_save, c_ref;
+		obj_t alpha, beta, norm;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		if ( row_stor )
+		{
+			bli_obj_create( dt, m, n, n, 1, &c );
+			bli_obj_create( dt, m, n, n, 1, &c_save );
+			bli_obj_create( dt, m, n, n, 1, &c_ref );
+		}
+		else
+		{
+			bli_obj_create( dt, m, n, 0, 0, &c );
+			bli_obj_create( dt, m, n, 0, 0, &c_save );
+			bli_obj_create( dt, m, n, 0, 0, &c_ref );
+		}
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_obj_scalar_init_detached( dt, &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_save );
+
+		bli_setsc(  1.2, 0.0, &alpha );
+		bli_setsc( -0.9, 0.0, &beta );
+
+		rntm_t rntm_pc = BLIS_RNTM_INITIALIZER;
+		bli_rntm_init_from_global( &rntm_pc );
+		bli_rntm_set_ways( 1, pc_nt, 1, 1, 1, &rntm_pc );
+
+		rntm_t rntm_serial = BLIS_RNTM_INITIALIZER;
+		bli_rntm_set_thread_impl( BLIS_SINGLE, &rntm_serial );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c );
+
+			double dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm_pc );
+
+			dtime_pc = bli_clock_min_diff( dtime_pc, dtime );
+
+			bli_copym( &c_save, &c_ref );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c_ref, NULL, &rntm_serial );
+
+			dtime_serial = bli_clock_min_diff( dtime_serial, dtime );
+		}
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+
+		double diff, diff_i;
+		bli_getsc( &norm, &diff, &diff_i );
+
+		double gflops_pc     = ( 2.0 * m * n * k ) / ( dtime_pc * 1.0e9 );
+		double gflops_serial = ( 2.0 * m * n * k ) / ( dtime_serial * 1.0e9 );
+
+		printf( "%6s %5lu %5lu %7lu  %10.2f  %14.2f  %8.2e\n",
+		        row_stor ? "row" : "col",
+		        ( unsigned long )m, ( unsigned long )n, ( unsigned long )k,
+		        gflops_pc, gflops_serial, diff );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
@@ -0,0 +1,136 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares the performance of a sequence of N_REUSE gemm
+// operations that share the same right-hand operand B when B is packed by
+// each operation (the usual case) and when B is packed once ahead of time
+// via bli_gemm_pack_b(). The time to pack B ahead of time is included in the
+// latter, and the results of the two are compared for correctness.
+
+int main( int argc, char** argv )
+{
+	obj_t  a, b, bp, c, c_save, c_ref;
+	obj_t  norm;
+	dim_t  m, n, k;
+	dim_t  p_begin, p_max, p_inc;
+	dim_t  n_repeats;
+	num_t  dt;
+	double resid, resid_i;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	dt = BLIS_DOUBLE;
+
+	printf( "%% reuse count: %d\n", ( int )N_REUSE );
+	printf( "%%     m     n     k  gflops(repack)  gflops(prepacked)  resid\n" );
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		double dtime_save    = DBL_MAX;
+		double dtime_save_pp = DBL_MAX;
+
+		m = n = k = p;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_save );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c_ref );
+
+			double dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_REUSE; ++i )
+				bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			bli_gemm_pack_b( &b, &bp, NULL );
+
+			for ( dim_t i = 0; i < N_REUSE; ++i )
+				bli_gemm( &BLIS_ONE, &a, &bp, &BLIS_ONE, &c );
+
+			dtime_save_pp = bli_clock_min_diff( dtime_save_pp, dtime );
+
+			bli_obj_free( &bp );
+		}
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+		bli_getsc( &norm, &resid, &resid_i );
+
+		double gflops = ( 2.0 * m * k * n * N_REUSE ) / 1.0e9;
+
+		printf( "%6lu %5lu %5lu  %14.2f  %17.2f  %7.2e\n",
+		        ( unsigned long )m,
+		        ( unsigned long )n,
+		        ( unsigned long )k,
+		        gflops / dtime_save,
+		        gflops / dtime_save_pp,
+		        resid );
+		fflush( stdout );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
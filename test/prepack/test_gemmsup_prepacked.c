@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares the performance of a sequence of N_REUSE_SUP skinny gemm
+// operations (with M_SUP rows of A and C) that share the same right-hand
+// operand B, which is the sort of problem that is handled by the
+// small/unpacked (sup) code path. B is either left unpacked, packed by each
+// operation (via the pack_b field of the rntm_t), or packed once ahead of
+// time via bli_gemmsup_pack_b(). The time to pack B ahead of time is included
+// in the latter, and its results are compared to those of the first for
+// correctness.
+
+int main( int argc, char** argv )
+{
+	obj_t  a, b, bp, c, c_save, c_ref;
+	obj_t  norm;
+	rntm_t rntm_pb;
+	dim_t  m, n, k;
+	dim_t  p_begin, p_max, p_inc;
+	dim_t  n_repeats;
+	num_t  dt;
+	double resid, resid_i;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_max   = P_END;
+	p_inc   = P_INC;
+
+	dt = BLIS_DOUBLE;
+
+	bli_rntm_init_from_global( &rntm_pb );
+	bli_rntm_set_pack_b( TRUE, &rntm_pb );
+
+	printf( "%% reuse count: %d\n", ( int )N_REUSE_SUP );
+	printf( "%%     m     n     k  gflops(unpacked)  gflops(repack)  gflops(prepacked)  resid\n" );
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		double dtime_save    = DBL_MAX;
+		double dtime_save_rp = DBL_MAX;
+		double dtime_save_pp = DBL_MAX;
+
+		m = M_SUP;
+		n = k = p;
+
+		// Use row storage, as is typical of inference workloads.
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+		bli_obj_create( dt, m, n, n, 1, &c_save );
+		bli_obj_create( dt, m, n, n, 1, &c_ref );
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_save );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c_ref );
+
+			double dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_REUSE_SUP; ++i )
+				bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_REUSE_SUP; ++i )
+				bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm_pb );
+
+			dtime_save_rp = bli_clock_min_diff( dtime_save_rp, dtime );
+
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			bli_gemmsup_pack_b( &b, &bp, NULL );
+
+			for ( dim_t i = 0; i < N_REUSE_SUP; ++i )
+				bli_gemm( &BLIS_ONE, &a, &bp, &BLIS_ONE, &c );
+
+			dtime_save_pp = bli_clock_min_diff( dtime_save_pp, dtime );
+
+			bli_obj_free( &bp );
+		}
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+		bli_getsc( &norm, &resid, &resid_i );
+
+		double gflops = ( 2.0 * m * k * n * N_REUSE_SUP ) / 1.0e9;
+
+		printf( "%6lu %5lu %5lu  %16.2f  %14.2f  %17.2f  %7.2e\n",
+		        ( unsigned long )m,
+		        ( unsigned long )n,
+		        ( unsigned long )k,
+		        gflops / dtime_save,
+		        gflops / dtime_save_rp,
+		        gflops / dtime_save_pp,
+		        resid );
+		fflush( stdout );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
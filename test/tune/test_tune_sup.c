@@ -0,0 +1,189 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, Southern Methodist University
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures, for each datatype handled by the small/unpacked
+// (sup) code path of the current sub-configuration, where the conventional
+// implementation of gemm overtakes the sup implementation along each of the
+// m, n, and k dimensions, with the other two dimensions held at P_LARGE. It
+// then prints a profile of sup thresholds that BLIS loads at initialization
+// when BLIS_SUP_THRESH_FILE is set to the name of a file that contains it,
+// in place of the thresholds set by the sub-configuration. The timings
+// behind each threshold are included in the profile as comments.
+
+static double time_gemm
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     )
+{
+	double dtime_save = DBL_MAX;
+
+	for ( dim_t r = 0; r < N_REPEATS; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_gemm_ex( &BLIS_ONE, a, b, &BLIS_ONE, c, NULL, rntm );
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	return dtime_save;
+}
+
+static dim_t tune_thresh
+     (
+       num_t   dt,
+       char    dt_char,
+       dim_t   dim,
+       rntm_t* rntm_sup,
+       rntm_t* rntm_conv
+     )
+{
+	const char* dim_str = "mnk";
+
+	// The threshold is one more than the largest problem size for which sup
+	// was faster, so that sup is used for all such sizes. If sup was never
+	// faster, the threshold is zero.
+	dim_t thresh = 0;
+
+	for ( dim_t p = P_BEGIN; p <= P_END; p += P_INC )
+	{
+		obj_t a, b, c;
+
+		dim_t m = ( dim == 0 ? p : P_LARGE );
+		dim_t n = ( dim == 1 ? p : P_LARGE );
+		dim_t k = ( dim == 2 ? p : P_LARGE );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		double dtime_sup  = time_gemm( &a, &b, &c, rntm_sup );
+		double dtime_conv = time_gemm( &a, &b, &c, rntm_conv );
+
+		if ( dtime_sup < dtime_conv ) thresh = p + 1;
+
+		double gflops = ( 2.0 * m * k * n ) / 1.0e9;
+
+		if ( bli_is_complex( dt ) ) gflops *= 4.0;
+
+		printf( "# %c %c %5lu %5lu %5lu  %8.2f  %8.2f\n",
+		        dt_char,
+		        dim_str[ dim ],
+		        ( unsigned long )m,
+		        ( unsigned long )n,
+		        ( unsigned long )k,
+		        gflops / dtime_sup,
+		        gflops / dtime_conv );
+		fflush( stdout );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	return thresh;
+}
+
+int main( int argc, char** argv )
+{
+	rntm_t rntm_sup, rntm_conv;
+
+	// Raise the sup thresholds (before BLIS is initialized, which is when
+	// they are read) so that every problem that is not explicitly steered
+	// away from the sup code path is computed via that path.
+	setenv( "BLIS_SUP_THRESH", "s 1000000 1000000 1000000;"
+	                           "d 1000000 1000000 1000000;"
+	                           "c 1000000 1000000 1000000;"
+	                           "z 1000000 1000000 1000000", 1 );
+
+	bli_init();
+
+	bli_rntm_init_from_global( &rntm_sup );
+	bli_rntm_init_from_global( &rntm_conv );
+	bli_rntm_disable_l3_sup( &rntm_conv );
+
+	const cntx_t* cntx     = bli_gks_query_cntx();
+	const char*   arch_str = bli_arch_string( bli_arch_query_id() );
+
+	const num_t   dts[ 4 ] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const char*   dt_chars = "sdcz";
+
+	printf( "# BLIS sup threshold profile for '%s'.\n", arch_str );
+	printf( "# To use it, set BLIS_SUP_THRESH_FILE to the name of this file.\n" );
+	printf( "#\n" );
+	printf( "# Timings: dt dim m n k gflops(sup) gflops(conv)\n" );
+
+	dim_t thresh[ 4 ][ 3 ];
+	bool  tuned[ 4 ];
+
+	for ( int i = 0; i < 4; ++i )
+	{
+		// Skip datatypes for which the sub-configuration has no sup kernels.
+		tuned[ i ] = ( bli_cntx_get_l3_sup_blksz_def_dt( dts[ i ], BLIS_MR, cntx ) > 0 );
+
+		if ( !tuned[ i ] ) continue;
+
+		for ( dim_t dim = 0; dim < 3; ++dim )
+			thresh[ i ][ dim ] = tune_thresh( dts[ i ], dt_chars[ i ], dim, &rntm_sup, &rntm_conv );
+	}
+
+	printf( "#\n" );
+	printf( "# %-10s dt     mt     nt     kt\n", "arch" );
+
+	for ( int i = 0; i < 4; ++i )
+	{
+		if ( !tuned[ i ] ) continue;
+
+		printf( "%-12s %c  %5lu  %5lu  %5lu\n",
+		        arch_str,
+		        dt_chars[ i ],
+		        ( unsigned long )thresh[ i ][ 0 ],
+		        ( unsigned long )thresh[ i ][ 1 ],
+		        ( unsigned long )thresh[ i ][ 2 ] );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
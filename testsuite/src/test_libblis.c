@@ -956,6 +956,8 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "  n dim thread ratio           %d\n", ( int )BLIS_THREAD_RATIO_N );
 	libblis_test_fprintf_c( os, "  jr max threads               %d\n", ( int )BLIS_THREAD_MAX_JR );
 	libblis_test_fprintf_c( os, "  ir max threads               %d\n", ( int )BLIS_THREAD_MAX_IR );
+	libblis_test_fprintf_c( os, "  min flops per thread         %d\n", ( int )BLIS_THREAD_MIN_FLOPS );
+	libblis_test_fprintf_c( os, "  min microtiles per thread    %d\n", ( int )BLIS_THREAD_MIN_TILES );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "ways of parallelism     nt    jc    pc    ic    jr    ir\n" );
 	libblis_test_fprintf_c( os, "  environment        %5s %5s %5s %5s %5s %5s\n",